@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+#
+# MIT License
+# Copyright © 2026 NyTekCFW
+# See LICENSE file for details.
+#
+# Compile-time benchmark: generates one TU with N obfuscated literals
+# and builds it with each encoding backend, reporting wall time and
+# peak compiler RSS. The same strings are then built as OBF_STCL
+# statics and as a tools/svxor_gen catalog (generator run included
+# in its time).
+#
+#   python3 bench/compile_bench.py [--count 5000] [--cxx g++] [--json]
+#
+
+import argparse
+import json
+import os
+import random
+import subprocess
+import sys
+import tempfile
+import time
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+HEADER = os.path.join(HERE, "..", "svxor.hpp")
+CATALOG_HEADER = os.path.join(HERE, "..", "svxor_catalog.hpp")
+GENERATOR = os.path.join(HERE, "..", "tools", "svxor_gen.cpp")
+
+BACKENDS = [
+	("index (C++11 pack)", ["-std=c++11"]),
+	("index (C++17, SVXOR_INDEX_BACKEND)", ["-std=c++17", "-DSVXOR_INDEX_BACKEND"]),
+	("loop (C++14 constexpr)", ["-std=c++14"]),
+	("loop (C++17 constexpr)", ["-std=c++17"]),
+]
+
+ALPHABET = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_"
+
+
+CATALOG_ROWS = [
+	("OBF_STCL statics (C++11)", "statics", ["-std=c++11"]),
+	("OBF_STCL statics (C++17)", "statics", ["-std=c++17"]),
+	("svxor_gen catalog (C++11)", "catalog", ["-std=c++11"]),
+]
+
+
+def strings(count, seed):
+	rng = random.Random(seed)
+	return ["".join(rng.choice(ALPHABET) for _ in range(rng.randint(4, 64))) for _ in range(count)]
+
+
+def generate(path, lits):
+	macros = ["OBF_LONCE", "OBF_HONCE", "OBF_L", "OBF_H"]
+	count = len(lits)
+	with open(path, "w") as f:
+		f.write('#include "%s"\n\n' % os.path.abspath(HEADER))
+		f.write("volatile unsigned long g_sink;\n\n")
+		per_fn = 100
+		for fn in range((count + per_fn - 1) // per_fn):
+			f.write("void f%d(void)\n{\n" % fn)
+			for i in range(fn * per_fn, min(count, (fn + 1) * per_fn)):
+				s = lits[i]
+				m = macros[i % len(macros)]
+				if m.endswith("ONCE"):
+					f.write('\tg_sink += %s("%s")[0];\n' % (m, s))
+				else:
+					f.write('\t{ auto o = %s("%s"); g_sink += o.c_str()[0]; }\n' % (m, s))
+			f.write("}\n\n")
+
+
+# one static accessor per string, used once (the svxor.cpp pattern)
+def generate_statics(path, lits):
+	with open(path, "w") as f:
+		f.write('#include "%s"\n\n' % os.path.abspath(HEADER))
+		f.write("volatile unsigned long g_sink;\n\n")
+		for i, s in enumerate(lits):
+			f.write('OBF_STCL(s%d, "%s")\n' % (i, s))
+		f.write("\nvoid use(void)\n{\n")
+		for i in range(len(lits)):
+			f.write("\tg_sink += obf_s%d().c_str()[0];\n" % i)
+		f.write("}\n")
+
+
+def generate_catalog(path, header, lits):
+	with open(path, "w") as f:
+		for i, s in enumerate(lits):
+			f.write('%d, s%d, "%s"\n' % (i, i, s))
+	with open(header + ".cpp", "w") as f:
+		f.write('#include "%s"\n\n' % os.path.basename(header))
+		f.write("volatile unsigned long g_sink;\n\n")
+		f.write("void use(void)\n{\n")
+		for i in range(len(lits)):
+			f.write("\tg_sink += cat::obf_s%d()[0];\n" % i)
+		f.write("}\n")
+
+
+def run(cmd):
+	start = time.monotonic()
+	proc = subprocess.run(cmd, stderr=subprocess.PIPE)
+	if proc.returncode != 0:
+		sys.stderr.write(proc.stderr.decode(errors="replace"))
+		return None
+	return time.monotonic() - start
+
+
+def build(cxx, flags, src, obj):
+	cmd = [cxx, "-O1", "-c", src, "-o", obj] + flags
+	start = time.monotonic()
+	proc = subprocess.Popen(cmd, stderr=subprocess.PIPE)
+	_, status, usage = os.wait4(proc.pid, 0)
+	elapsed = time.monotonic() - start
+	err = proc.stderr.read().decode(errors="replace")
+	proc.stderr.close()
+	if status != 0:
+		sys.stderr.write(err)
+		return None
+	return {
+		"seconds": round(elapsed, 3),
+		"peak_rss_mb": round(usage.ru_maxrss / 1024.0, 1),
+		"object_kb": round(os.path.getsize(obj) / 1024.0, 1),
+	}
+
+
+def main():
+	ap = argparse.ArgumentParser()
+	ap.add_argument("--count", type=int, default=5000)
+	ap.add_argument("--cxx", default=os.environ.get("CXX", "g++"))
+	ap.add_argument("--seed", type=int, default=1)
+	ap.add_argument("--json", action="store_true")
+	args = ap.parse_args()
+
+	results = []
+	lits = strings(args.count, args.seed)
+	with tempfile.TemporaryDirectory() as tmp:
+		src = os.path.join(tmp, "literals.cpp")
+		obj = os.path.join(tmp, "literals.o")
+		generate(src, lits)
+		rows = [(name, src, flags, 0.0) for name, flags in BACKENDS]
+
+		statics = os.path.join(tmp, "statics.cpp")
+		generate_statics(statics, lits)
+
+		# the generator is built once (not timed), then run per build
+		gen = os.path.join(tmp, "svxor_gen")
+		catalog = os.path.join(tmp, "catalog.txt")
+		header = os.path.join(tmp, "catalog.hpp")
+		generate_catalog(catalog, header, lits)
+		gen_seconds = None
+		if run([args.cxx, "-std=c++11", "-O1", GENERATOR, "-o", gen]) is not None:
+			gen_seconds = run([gen, "--seed", "1", "--ns", "cat", "--include", os.path.abspath(CATALOG_HEADER), "-o", header, catalog])
+		for name, kind, flags in CATALOG_ROWS:
+			if kind == "statics":
+				rows.append((name, statics, flags, 0.0))
+			elif gen_seconds is not None:
+				rows.append((name, header + ".cpp", flags, gen_seconds))
+			else:
+				rows.append((name, None, flags, 0.0))
+
+		for name, path, flags, extra in rows:
+			r = build(args.cxx, flags, path, obj) if path else None
+			if r is None:
+				r = {"error": True}
+			elif extra:
+				r["generator_seconds"] = round(extra, 3)
+				r["seconds"] = round(r["seconds"] + extra, 3)
+			r["backend"] = name
+			results.append(r)
+			if not args.json:
+				if "error" in r:
+					print("%-38s build failed" % name)
+				else:
+					print("%-38s %8.2f s %9.1f MB peak RSS %9.1f KB .o" % (name, r["seconds"], r["peak_rss_mb"], r["object_kb"]))
+	if args.json:
+		print(json.dumps({"cxx": args.cxx, "count": args.count, "results": results}, indent=2))
+
+
+if __name__ == "__main__":
+	main()
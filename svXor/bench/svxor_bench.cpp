@@ -0,0 +1,1136 @@
+/*
+ * MIT License
+ * Copyright © 2026 NyTekCFW
+ * See LICENSE file for details.
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//? pulls in svxor.hpp and the staticObfx() demo table
+#define SVXOR_NO_MAIN
+#include "../svxor.cpp"
+#include "../svxor_blob.hpp"
+#include "../svxor_ttl.hpp"
+
+// =========================
+// BENCH HARNESS
+// =========================
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+# ifdef _MSC_VER
+#  include <intrin.h>
+# else
+#  include <x86intrin.h>
+# endif
+# define BENCH_HAS_TSC 1
+#endif
+
+static volatile size_t g_sink = 0;
+
+struct Sample
+{
+	double	ns;		//? per op
+	double	cycles;	//? per op (TSC ticks), 0 when unavailable
+};
+
+struct Record
+{
+	const char*	section;
+	std::string	name;
+	size_t		bytes;
+	Sample		s;
+};
+
+static std::vector<Record>	g_records;
+static const char*			g_section = "";
+static bool					g_json = false;
+static size_t				g_failed = 0;	//? self-checks, non-zero exit
+
+static inline uint64_t ticks(void)
+{
+#ifdef BENCH_HAS_TSC
+	return (uint64_t(__rdtsc()));
+#else
+	return (0);
+#endif
+}
+
+//? ============================================================
+//? Runs fn() in batches until ~50 ms elapsed
+//? ============================================================
+template<typename F>
+static Sample measure(F fn)
+{
+	typedef std::chrono::steady_clock clk;
+	size_t	iters = 1024;
+
+	for (;;)
+	{
+		auto		start = clk::now();
+		uint64_t	t0 = ticks();
+		for (size_t i = 0; i < iters; ++i)
+			fn();
+		uint64_t	t1 = ticks();
+		auto		ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clk::now() - start).count();
+		if (ns > 50000000 || iters >= (size_t(1) << 30))
+		{
+			Sample r = { double(ns) / double(iters), double(t1 - t0) / double(iters) };
+			return (r);
+		}
+		iters *= 2;
+	}
+}
+
+//? ============================================================
+//? Records one result: table line, or JSON entry (--json)
+//? bytes: payload size per op (0: not a throughput figure)
+//? ============================================================
+static void report(const std::string& name, size_t bytes, const Sample& s)
+{
+	Record r = { g_section, name, bytes, s };
+
+	g_records.push_back(r);
+	if (g_json)
+		return;
+	std::printf("  %-40s %6zu B %10.2f ns %10.1f cyc", name.c_str(), bytes, s.ns, s.cycles);
+	if (bytes)
+		std::printf(" %10.1f MB/s", double(bytes) * 1000.0 / s.ns);
+	std::printf("\n");
+}
+
+static void report(const std::string& name, size_t bytes, double ns)
+{
+	Sample s = { ns, 0 };
+
+	report(name, bytes, s);
+}
+
+//? ============================================================
+//? Derived sample (a - b), e.g. destructor = ctor+dtor - ctor
+//? ============================================================
+static Sample diff(const Sample& a, const Sample& b)
+{
+	Sample r = { a.ns - b.ns, a.cycles - b.cycles };
+
+	return (r);
+}
+
+static void jsonString(const char* s)
+{
+	std::putchar('"');
+	for (; *s; ++s)
+	{
+		if (*s == '"' || *s == '\\')
+			std::putchar('\\');
+		std::putchar(*s);
+	}
+	std::putchar('"');
+}
+
+static void printJson(void)
+{
+	std::printf("{\n  \"build\": {");
+	std::printf("\"cplusplus\": %ld, ", long(__cplusplus));
+#ifdef __VERSION__
+	std::printf("\"compiler\": ");
+	jsonString(__VERSION__);
+	std::printf(", ");
+#endif
+#ifdef __SNC__
+	std::printf("\"snc\": true, ");
+#else
+	std::printf("\"snc\": false, ");
+#endif
+#ifdef SVXOR_SSE2
+	std::printf("\"sse2\": true, ");
+#else
+	std::printf("\"sse2\": false, ");
+#endif
+#ifdef SVXOR_AVX2
+	std::printf("\"avx2\": true, ");
+#else
+	std::printf("\"avx2\": false, ");
+#endif
+#ifdef BENCH_HAS_TSC
+	std::printf("\"tsc\": true");
+#else
+	std::printf("\"tsc\": false");
+#endif
+	std::printf("},\n  \"results\": [\n");
+	for (size_t i = 0; i < g_records.size(); ++i)
+	{
+		const Record& r = g_records[i];
+
+		std::printf("    {\"section\": ");
+		jsonString(r.section);
+		std::printf(", \"name\": ");
+		jsonString(r.name.c_str());
+		std::printf(", \"bytes\": %zu, \"ns_per_op\": %.3f, \"cycles_per_op\": %.1f, \"bytes_per_s\": %.0f}%s\n",
+			r.bytes, r.s.ns, r.s.cycles, r.bytes ? double(r.bytes) * 1e9 / r.s.ns : 0.0,
+			(i + 1 < g_records.size()) ? "," : "");
+	}
+	std::printf("  ]\n}\n");
+}
+
+// =========================
+// XOR KERNEL (LIGHT unlock/lock)
+// =========================
+
+static volatile char g_data[4096 + 1];
+static volatile char g_ks[4096 + 1];
+static volatile uint64_t g_key = svxor::BUILD_KEY;
+
+//? reference: the byte loop LIGHT mode used before xorBytes
+static void xorByteLoop(volatile char* data, const volatile char* ks, size_t n)
+{
+	for (size_t i = 0; i < n; ++i)
+		data[i] = data[i] ^ ks[i];
+}
+
+//? reference: one mix() call per regenerated byte
+static void mixByteLoop(volatile char* data, uint64_t k, size_t n)
+{
+	for (size_t i = 0; i < n; ++i)
+		data[i] = data[i] ^ char(svxor::mix(k, int(i)));
+}
+
+static void benchXorKernel(void)
+{
+	for (size_t i = 0; i < sizeof(g_ks); ++i)
+	{
+		g_data[i] = char(i * 7);
+		g_ks[i] = svxor::getKeyStream(svxor::BUILD_KEY, int(i));
+	}
+	for (size_t n = 4; n <= 4096; n *= 2)
+	{
+		report("byte loop", n, measure([n] { xorByteLoop(g_data, g_ks, n); g_sink = g_sink + size_t(g_data[0]); }));
+		report("xorBytes", n, measure([n] { svxor::xorBytes(g_data, g_ks, n); g_sink = g_sink + size_t(g_data[0]); }));
+		report("mix() byte loop (regen)", n, measure([n] { mixByteLoop(g_data, g_key, n); g_sink = g_sink + size_t(g_data[0]); }));
+		report("xorMix (regen)", n, measure([n] { svxor::xorMix(g_data, g_key, n); g_sink = g_sink + size_t(g_data[0]); }));
+		report("xorCtr (regen, KS_CTR)", n, measure([n] { svxor::xorCtr(g_data, g_data, g_key, n); g_sink = g_sink + size_t(g_data[0]); }));
+	}
+}
+
+// =========================
+// MODES: OBF / OBF_ONCE / OBF_ST / OBF_STC
+// =========================
+
+#define BENCH_S8	"sys_ppu_"
+#define BENCH_S32	BENCH_S8 BENCH_S8 BENCH_S8 BENCH_S8
+#define BENCH_S128	BENCH_S32 BENCH_S32 BENCH_S32 BENCH_S32
+#define BENCH_S512	BENCH_S128 BENCH_S128 BENCH_S128 BENCH_S128
+
+#ifndef __SNC__
+# define BENCH_CSTR(x) (x).c_str()
+#else
+# define BENCH_CSTR(x) (x)
+#endif
+
+OBF_STL(st8, BENCH_S8)
+OBF_STL(st32, BENCH_S32)
+OBF_STL(st128, BENCH_S128)
+OBF_STL(st512, BENCH_S512)
+OBF_STCL(stc8, BENCH_S8)
+OBF_STCL(stc32, BENCH_S32)
+OBF_STCL(stc128, BENCH_S128)
+OBF_STCL(stc512, BENCH_S512)
+
+//? OBF_ST* objects stay unlocked once decoded (SNC: cached buffer),
+//? "+ lock" re-encrypts after every read.
+//? "OBF_x c_str + lock": one long-lived object, decoded and
+//? re-encrypted per op (no static RAII objects on SNC).
+#ifndef __SNC__
+# define BENCH_ST_LOCK(fname, label, n) \
+	report(label " c_str + lock", n, measure([] { g_sink = g_sink + size_t(obf_##fname().c_str()[0]); obf_##fname().lock(); }));
+# define BENCH_OBJ_LOCK(str, n) \
+	report("OBF_L c_str + lock", n, measure([] { static auto o = OBF_L(str); g_sink = g_sink + size_t(o.c_str()[0]); o.lock(); })); \
+	report("OBF_H c_str + lock", n, measure([] { static auto o = OBF_H(str); g_sink = g_sink + size_t(o.c_str()[0]); o.lock(); })); \
+	report("OBFX heavy cached c_str + lock", n, measure([] { static auto o = OBFX(str, true, svxor::HV_CACHED); g_sink = g_sink + size_t(o.c_str()[0]); o.lock(); })); \
+	report("OBFX light regen c_str + lock", n, measure([] { static auto o = OBFX(str, false, svxor::KS_REGEN); g_sink = g_sink + size_t(o.c_str()[0]); o.lock(); })); \
+	report("OBFX light ctr regen c_str + lock", n, measure([] { static auto o = OBFX(str, false, svxor::KS_CTR | svxor::KS_REGEN); g_sink = g_sink + size_t(o.c_str()[0]); o.lock(); }));
+#else
+# define BENCH_ST_LOCK(fname, label, n)
+# define BENCH_OBJ_LOCK(str, n)
+#endif
+
+#define BENCH_MODES(str, st, stc) \
+	{ \
+		const size_t n = sizeof(str) - 1; \
+		report("OBF_L c_str + dtor", n, measure([] { auto o = OBF_L(str); g_sink = g_sink + size_t(o.c_str()[0]); })); \
+		report("OBF_H c_str + dtor", n, measure([] { auto o = OBF_H(str); g_sink = g_sink + size_t(o.c_str()[0]); })); \
+		report("OBFX light regen c_str + dtor", n, measure([] { auto o = OBFX(str, false, svxor::KS_REGEN); g_sink = g_sink + size_t(o.c_str()[0]); })); \
+		report("OBFX heavy regen c_str + dtor", n, measure([] { auto o = OBFX(str, true, svxor::KS_REGEN); g_sink = g_sink + size_t(o.c_str()[0]); })); \
+		report("OBFX heavy cached c_str + dtor", n, measure([] { auto o = OBFX(str, true, svxor::HV_CACHED); g_sink = g_sink + size_t(o.c_str()[0]); })); \
+		report("OBFX heavy regen cached c_str + dtor", n, measure([] { auto o = OBFX(str, true, svxor::KS_REGEN | svxor::HV_CACHED); g_sink = g_sink + size_t(o.c_str()[0]); })); \
+		report("OBFX light ctr c_str + dtor", n, measure([] { auto o = OBFX(str, false, svxor::KS_CTR); g_sink = g_sink + size_t(o.c_str()[0]); })); \
+		report("OBFX light ctr regen c_str + dtor", n, measure([] { auto o = OBFX(str, false, svxor::KS_CTR | svxor::KS_REGEN); g_sink = g_sink + size_t(o.c_str()[0]); })); \
+		BENCH_OBJ_LOCK(str, n) \
+		report("OBF_LONCE", n, measure([] { g_sink = g_sink + size_t(OBF_LONCE(str)[0]); })); \
+		report("OBF_HONCE", n, measure([] { g_sink = g_sink + size_t(OBF_HONCE(str)[0]); })); \
+		report("OBF_STL", n, measure([] { g_sink = g_sink + size_t(BENCH_CSTR(obf_##st())[0]); })); \
+		BENCH_ST_LOCK(st, "OBF_STL", n) \
+		report("OBF_STCL", n, measure([] { g_sink = g_sink + size_t(BENCH_CSTR(obf_##stc())[0]); })); \
+		BENCH_ST_LOCK(stc, "OBF_STCL", n) \
+	}
+
+static void benchModes(void)
+{
+	BENCH_MODES(BENCH_S8, st8, stc8)
+	BENCH_MODES(BENCH_S32, st32, stc32)
+	BENCH_MODES(BENCH_S128, st128, stc128)
+	BENCH_MODES(BENCH_S512, st512, stc512)
+}
+
+// =========================
+// DESTRUCTOR WIPE
+// =========================
+
+//? ctor alone (placement new, never destroyed), dtor alone on a
+//? copy of an unlocked object: image copy + dtor - image copy
+#define BENCH_DTOR(label, str, heavy, flags) \
+	{ \
+		typedef OBF_TYPE(str, heavy, flags) T; \
+		alignas(64) static unsigned char	mem[sizeof(T)]; \
+		alignas(64) static unsigned char	img[sizeof(T)]; \
+		const size_t						n = sizeof(str) - 1; \
+		(new (img) T(str, OBF_SALT()))->c_str(); \
+		Sample a = measure([] { std::memcpy(mem, img, sizeof(T)); SVXOR_BARRIER(mem); }); \
+		Sample b = measure([] { std::memcpy(mem, img, sizeof(T)); SVXOR_BARRIER(mem); reinterpret_cast<T*>(mem)->~T(); }); \
+		report(label " ctor", n, measure([] { T* o = new (mem) T(str, OBF_SALT()); g_sink = g_sink + size_t(o->c_data()[0]); })); \
+		report(label " dtor (wipe)", n, diff(b, a)); \
+	}
+
+#define BENCH_DTORS(str) \
+	BENCH_DTOR("LIGHT", str, false, svxor::KS_STORED) \
+	BENCH_DTOR("HEAVY", str, true, svxor::KS_STORED) \
+	BENCH_DTOR("HEAVY cached", str, true, svxor::HV_CACHED) \
+	BENCH_DTOR("LIGHT regen", str, false, svxor::KS_REGEN) \
+	BENCH_DTOR("LIGHT WIPE_PLAIN", str, false, svxor::WIPE_PLAIN) \
+	BENCH_DTOR("LIGHT WIPE_NONE", str, false, svxor::WIPE_NONE)
+
+static volatile char g_wipe[4096 + 1];
+
+//? reference: the volatile byte loop ~ObfString used before secureWipe
+static void wipeByteLoop(volatile char* p, size_t n)
+{
+	for (size_t i = 0; i < n; ++i)
+		p[i] = 0;
+}
+
+static void benchDtor(void)
+{
+	for (size_t n = 8; n <= 4096; n *= 4)
+	{
+		report("volatile byte loop", n, measure([n] { wipeByteLoop(g_wipe, n); g_sink = g_sink + size_t(g_wipe[0]); }));
+		report("secureWipe", n, measure([n] { svxor::secureWipe(g_wipe, n); g_sink = g_sink + size_t(g_wipe[0]); }));
+	}
+	BENCH_DTORS(BENCH_S8)
+	BENCH_DTORS(BENCH_S32)
+	BENCH_DTORS(BENCH_S128)
+	BENCH_DTORS(BENCH_S512)
+}
+
+// =========================
+// STATIC LOOKUP (OBF_ST vs OBF_STC vs staticObfx)
+// =========================
+
+//? the demo's module list (SVXOR_MODULES, ../svxor.cpp): every
+//? id, once per storage kind, plus the shipped staticObfx()
+#define BENCH_MODULE_ID(id, fname, s) id,
+#define BENCH_MODULE_ST(id, fname, s) OBF_STL(g_##fname, s)
+#define BENCH_MODULE_STC(id, fname, s) OBF_STCL(c_##fname, s)
+#define BENCH_MODULE_GUARDED(id, fname, s) case id: return BENCH_CSTR(obf_g_##fname());
+#define BENCH_MODULE_CONST(id, fname, s) case id: return BENCH_CSTR(obf_c_##fname());
+
+static const int	g_moduleIds[] = { SVXOR_MODULES(BENCH_MODULE_ID) };
+
+SVXOR_MODULES(BENCH_MODULE_ST)
+SVXOR_MODULES(BENCH_MODULE_STC)
+
+//? staticObfx() shaped lookups, one per storage kind
+static const char* lookupGuarded(int id)
+{
+	switch (id)
+	{
+		SVXOR_MODULES(BENCH_MODULE_GUARDED)
+		default: return nullptr;
+	}
+}
+
+static const char* lookupConst(int id)
+{
+	switch (id)
+	{
+		SVXOR_MODULES(BENCH_MODULE_CONST)
+		default: return nullptr;
+	}
+}
+
+static void benchStaticLookup(void)
+{
+	static const size_t	count = sizeof(g_moduleIds) / sizeof(g_moduleIds[0]);
+	static size_t		i = 0;
+
+#if defined(SVXOR_HAS_TABLE) && !defined(__SNC__)
+	const std::string shipped = "staticObfx (OBF_TABLE)";
+#else
+	const std::string shipped = "staticObfx (OBF_STC switch)";
+#endif
+	report("OBF_ST  (guarded static)", 0, measure([] { g_sink = g_sink + size_t(lookupGuarded(g_moduleIds[i = (i + 1) % count])[0]); }));
+	report("OBF_STC (constant-init)", 0, measure([] { g_sink = g_sink + size_t(lookupConst(g_moduleIds[i = (i + 1) % count])[0]); }));
+	report(shipped, 0, measure([] { g_sink = g_sink + size_t(staticObfx(g_moduleIds[i = (i + 1) % count])[0]); }));
+}
+
+// =========================
+// staticObfx LOOKUP / ENUMERATION
+// =========================
+
+//? C++14+: OBF_TABLE perfect hash, C++11: OBF_STC + switch
+static void benchStaticObfx(void)
+{
+	static const int	ids[] = { 0x0000, 0x0003, 0x000a, 0x0015, 0x0023, 0x0031, 0x003f, 0xf00a, 0xf02b, 0xf054 };
+	static int			shuffled[4096];
+	static size_t		i = 0;
+	std::vector<int>	valid;
+	uint64_t			rng = 0x9E3779B97F4A7C15ULL;
+
+	for (int id = 0; id < 0xf055; ++id)
+	{
+		if (staticObfx(id))
+			valid.push_back(id);
+	}
+	for (size_t k = 0; k < 4096; ++k)
+	{
+		rng = svxor::mix64(rng);
+		shuffled[k] = valid[size_t(rng % valid.size())];
+	}
+
+#if defined(SVXOR_HAS_TABLE) && !defined(__SNC__)
+	const std::string backend = "table: ";
+#else
+	const std::string backend = "switch: ";
+#endif
+	report(backend + "lookup (hit, 10-id cycle)", 0, measure([] { g_sink = g_sink + size_t(staticObfx(ids[i++ % 10])[0]); }));
+	report(backend + "lookup (hit, random ids)", 0, measure([] { g_sink = g_sink + size_t(staticObfx(shuffled[i++ & 4095])[0]); }));
+	report(backend + "lookup (miss)", 0, measure([] { g_sink = g_sink + size_t(staticObfx(0x0040) == nullptr); }));
+	report(backend + "enumerate (scan 0..0xf054)", 0, measure([]
+	{
+		for (int id = 0; id < 0xf055; ++id)
+		{
+			const char* p = staticObfx(id);
+			if (p)
+				g_sink = g_sink + size_t(p[0]);
+		}
+	}));
+#if defined(SVXOR_HAS_TABLE) && !defined(__SNC__)
+	report(backend + "enumerate (for_each)", 0, measure([] { g_modules.for_each([](uint32_t, const char* p) { g_sink = g_sink + size_t(p[0]); }); }));
+#endif
+}
+
+// =========================
+// MULTI-THREADED staticObfx
+// =========================
+
+//? ns per call and per thread (wall time * threads / calls)
+static void benchStaticObfxThreads(void)
+{
+	static const int	ids[] = { 0x0000, 0x0003, 0x000a, 0x0015, 0x0023, 0x0031, 0x003f, 0xf00a, 0xf02b, 0xf054 };
+	const int			count = int(sizeof(ids) / sizeof(ids[0]));
+
+	for (int threads = 1; threads <= 64; threads *= 2)
+	{
+		std::atomic<bool>		go(false);
+		std::atomic<bool>		stop(false);
+		std::atomic<uint64_t>	total(0);
+		std::atomic<size_t>		sink(0);
+		std::vector<std::thread>	pool;
+
+		for (int t = 0; t < threads; ++t)
+		{
+			pool.emplace_back([&, t]
+			{
+				uint64_t	n = 0;
+				size_t		local = 0;
+
+				while (!go.load(std::memory_order_acquire))
+					std::this_thread::yield();
+				for (int i = t; !stop.load(std::memory_order_relaxed); ++i)
+				{
+					local += size_t(staticObfx(ids[i % count])[0]);
+					++n;
+				}
+				total += n;
+				sink.fetch_add(local, std::memory_order_relaxed);
+			});
+		}
+		auto start = std::chrono::steady_clock::now();
+		go.store(true, std::memory_order_release);
+		std::this_thread::sleep_for(std::chrono::milliseconds(200));
+		stop.store(true);
+		for (size_t t = 0; t < pool.size(); ++t)
+			pool[t].join();
+		double ns = double(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+		g_sink = g_sink + sink.load();
+		report("threads=" + std::to_string(threads), 0, ns * threads / double(total.load()));
+	}
+}
+
+//? ============================================================
+//? Concurrent first use: every thread walks all ids at once and
+//? checks each name with the reverse lookup. Run this section
+//? alone (objects still cold), ideally under ThreadSanitizer:
+//?   g++ -std=c++11 -D__SNC__ -fsanitize=thread -O1 -g ...
+//?   ./svxor_bench once_stress
+//? ============================================================
+static void benchOnceStress(void)
+{
+	const int				threads = 8;
+	std::atomic<bool>		go(false);
+	std::atomic<size_t>		bad(0);
+	std::vector<std::thread>	pool;
+
+	for (int t = 0; t < threads; ++t)
+	{
+		pool.emplace_back([&, t]
+		{
+			while (!go.load(std::memory_order_acquire))
+				std::this_thread::yield();
+			for (int i = 0; i < 0xf055; ++i)
+			{
+				const int	id = (i + t * 0x1e0b) % 0xf055;
+				const char*	p = staticObfx(id);
+
+				if (p && staticObfId(p) != id)
+					++bad;
+			}
+		});
+	}
+	auto start = std::chrono::steady_clock::now();
+	go.store(true, std::memory_order_release);
+	for (size_t t = 0; t < pool.size(); ++t)
+		pool[t].join();
+	double ns = double(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+	report("threads=" + std::to_string(threads) + ", all ids", 0, ns);
+	if (bad.load())
+		std::fprintf(stderr, "once_stress: %zu wrong names\n", bad.load());
+	g_failed += bad.load();
+}
+
+// =========================
+// NEIGHBOURS: 2 threads, each unlocks + locks its own object
+// =========================
+
+//? two objects side by side, one thread each: without ALIGN_LINE
+//? small objects share a cache line (false sharing)
+template<typename T>
+static void benchNeighboursOne(const std::string& label, const char* s)
+{
+	alignas(SVXOR_CACHE_LINE) static unsigned char	mem[2 * sizeof(T)];
+	T*						objs[2] = { new (mem) T(s, OBF_SALT()), new (mem + sizeof(T)) T(s, OBF_SALT()) };
+	std::atomic<bool>		go(false);
+	std::atomic<bool>		stop(false);
+	std::atomic<uint64_t>	total(0);
+	std::atomic<size_t>		sink(0);
+	std::vector<std::thread>	pool;
+
+	for (int t = 0; t < 2; ++t)
+	{
+		pool.emplace_back([&, t]
+		{
+			T*			o = objs[t];
+			uint64_t	n = 0;
+			size_t		local = 0;
+
+			while (!go.load(std::memory_order_acquire))
+				std::this_thread::yield();
+			for (; !stop.load(std::memory_order_relaxed); ++n)
+			{
+				local += size_t(o->c_str()[0]);
+				o->lock();
+			}
+			total += n;
+			sink.fetch_add(local, std::memory_order_relaxed);
+		});
+	}
+	auto start = std::chrono::steady_clock::now();
+	go.store(true, std::memory_order_release);
+	std::this_thread::sleep_for(std::chrono::milliseconds(200));
+	stop.store(true);
+	for (size_t t = 0; t < pool.size(); ++t)
+		pool[t].join();
+	double ns = double(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+	g_sink = g_sink + sink.load();
+	report(label + " (" + std::to_string(svxor::Layout<T>::bytes) + " B objects)", T::size(), ns * 2 / double(total.load()));
+	objs[0]->~T();
+	objs[1]->~T();
+}
+
+#define BENCH_NEIGHBOURS(label, str, flags) benchNeighboursOne<OBF_TYPE(str, false, flags)>(label, str);
+
+static void benchNeighbours(void)
+{
+	BENCH_NEIGHBOURS("regen", BENCH_S8, svxor::KS_REGEN)
+	BENCH_NEIGHBOURS("regen packed", BENCH_S8, svxor::KS_REGEN | svxor::LAYOUT_PACKED)
+	BENCH_NEIGHBOURS("regen ALIGN_LINE", BENCH_S8, svxor::KS_REGEN | svxor::ALIGN_LINE)
+	BENCH_NEIGHBOURS("stored", BENCH_S32, svxor::KS_STORED)
+	BENCH_NEIGHBOURS("stored packed", BENCH_S32, svxor::LAYOUT_PACKED)
+	BENCH_NEIGHBOURS("stored ALIGN_LINE", BENCH_S32, svxor::ALIGN_LINE)
+}
+
+// =========================
+// decode_to() vs c_str() + strcpy + lock()
+// =========================
+
+template<typename T>
+static void benchDecodeOne(const std::string& label, T& s)
+{
+	static char	dst[512 + 1];
+
+	report(label + " decode_to", s.size(), measure([&] { s.decode_to(dst, sizeof(dst)); g_sink = g_sink + size_t(dst[0]); }));
+	report(label + " c_str + strcpy + lock", s.size(), measure([&] { std::strcpy(dst, s.c_str()); s.lock(); g_sink = g_sink + size_t(dst[0]); }));
+	report(label + " decode_chunks", s.size(), measure([&] { s.decode_chunks([](const char* p, size_t) { g_sink = g_sink + size_t(p[0]); }); }));
+}
+
+#define BENCH_DECODE(str) \
+	{ auto l = OBF_L(str); benchDecodeOne("LIGHT", l); \
+	  auto h = OBF_H(str); benchDecodeOne("HEAVY", h); \
+	  auto r = OBFX(str, false, svxor::KS_REGEN); benchDecodeOne("LIGHT regen", r); }
+
+static void benchDecodeTo(void)
+{
+	BENCH_DECODE(BENCH_S8)
+	BENCH_DECODE(BENCH_S32)
+	BENCH_DECODE(BENCH_S128)
+	BENCH_DECODE(BENCH_S512)
+}
+
+// =========================
+// decode_range / at / starts_with vs a full decode, 512 B string
+// =========================
+
+template<typename T>
+static void benchPartialOne(const std::string& label, T& s)
+{
+	static char		dst[512 + 1];
+	static size_t	i = 0;
+
+	report(label + " decode_to (all)", s.size(), measure([&] { s.decode_to(dst, sizeof(dst)); g_sink = g_sink + size_t(dst[0]); }));
+	report(label + " decode_range 16 @ 256", 16, measure([&] { s.decode_range(256, 16, dst); g_sink = g_sink + size_t(dst[0]); }));
+	report(label + " at(i)", 1, measure([&] { g_sink = g_sink + size_t(s.at(i++ & 511)); }));
+	report(label + " starts_with 8", 8, measure([&] { g_sink = g_sink + size_t(s.starts_with(BENCH_S8, 8)); }));
+}
+
+static void benchPartial(void)
+{
+	auto l = OBF_L(BENCH_S512);
+	auto r = OBFX(BENCH_S512, false, svxor::KS_REGEN);
+	auto c = OBFX(BENCH_S512, false, svxor::KS_CTR | svxor::KS_REGEN);
+
+	benchPartialOne("LIGHT", l);
+	benchPartialOne("LIGHT regen", r);
+	benchPartialOne("LIGHT ctr regen", c);
+	report("strncmp(OBF_LONCE) 8", 8, measure([] { g_sink = g_sink + size_t(std::strncmp(OBF_LONCE(BENCH_S512), BENCH_S8, 8) == 0); }));
+}
+
+//? ============================================================
+//? std::string conversion and scoped view, memory passes over
+//? the string in brackets (decode, strlen, copy, relock, the
+//? zero fill of resize() before C++23)
+//? ============================================================
+#if defined(__cpp_lib_string_resize_and_overwrite)
+# define BENCH_TO_STRING " to_string [1]"
+#else
+# define BENCH_TO_STRING " to_string [2]"
+#endif
+
+template<typename T>
+static void benchStringOne(const std::string& label, T& s)
+{
+	report(label + " std::string(c_str) + lock [4]", s.size(), measure([&] { std::string t(s.c_str()); s.lock(); g_sink = g_sink + size_t(t[0]); }));
+	report(label + BENCH_TO_STRING, s.size(), measure([&] { std::string t = s.to_string(); g_sink = g_sink + size_t(t[0]); }));
+	report(label + " c_str + lock [2]", s.size(), measure([&] { g_sink = g_sink + size_t(s.c_str()[0]); s.lock(); }));
+	report(label + " view [2]", s.size(), measure([&] { auto v = s.view(); g_sink = g_sink + size_t(v.c_str()[0]); }));
+}
+
+#define BENCH_STRING(str) \
+	{ auto l = OBF_L(str); benchStringOne("LIGHT", l); \
+	  auto r = OBFX(str, false, svxor::KS_REGEN); benchStringOne("LIGHT regen", r); }
+
+static void benchString(void)
+{
+	BENCH_STRING(BENCH_S8)
+	BENCH_STRING(BENCH_S128)
+	BENCH_STRING(BENCH_S512)
+
+	//? stored keystream: two 512 byte buffers per object
+	auto	h = OBF_H(BENCH_S512);
+	Sample	copy = measure([&] { auto c(h); g_sink = g_sink + size_t(c.c_data()[0]); });
+	Sample	move = measure([&] { auto c(h); auto m(std::move(c)); g_sink = g_sink + size_t(m.c_data()[0]); });
+
+	report("HEAVY copy (+ dtor)", h.size(), copy);
+	report("HEAVY move (+ dtor of both)", h.size(), diff(move, copy));
+}
+
+//? ============================================================
+//? Self-check of the ObfString value semantics (no timing):
+//? to_string / view / copies / moves. Mismatches go to stderr
+//? and make the bench exit non-zero:
+//?   ./svxor_bench string_check
+//? ============================================================
+#define BENCH_CHECK(c) \
+	do { if (!(c)) { std::fprintf(stderr, "string_check: %s:%d: %s\n", label, __LINE__, #c); ++g_failed; } } while (0)
+
+//? true while the raw buffer holds the plaintext
+template<typename T>
+static bool isOpen(T& s, const char* str)
+{
+	return (std::memcmp(s.c_data(), str, std::strlen(str)) == 0);
+}
+
+template<typename T>
+static void checkStringOne(const char* label, T& s, const char* str)
+{
+	const size_t	n = std::strlen(str);
+
+	static_assert(std::is_nothrow_move_constructible<T>::value, "ObfString move ctor must be noexcept");
+	static_assert(std::is_nothrow_move_assignable<T>::value, "ObfString move assignment must be noexcept");
+
+	s.lock();
+	BENCH_CHECK(s.to_string() == str);
+	BENCH_CHECK(!isOpen(s, str));
+
+	//? nested views: the last one out relocks
+	{
+		auto v = s.view();
+
+		BENCH_CHECK(v.size() == n && !std::strcmp(v.c_str(), str));
+		{
+			auto w = s.view();
+
+			BENCH_CHECK(!std::strcmp(w.c_str(), str));
+		}
+		BENCH_CHECK(isOpen(s, str));
+	}
+	BENCH_CHECK(!isOpen(s, str));
+
+	//? a Reader outliving the View relocks on its way out
+	{
+		auto r = s.read();
+
+		{ auto v = s.view(); }
+		BENCH_CHECK(!std::strcmp(r.c_str(), str));
+	}
+	BENCH_CHECK(!isOpen(s, str));
+
+	//? read() leaves it decoded, unlock() cancels a pending relock
+	{ auto r = s.read(); }
+	BENCH_CHECK(isOpen(s, str));
+	{
+		auto r = s.read();
+
+		{ auto v = s.view(); }
+		s.unlock();
+	}
+	BENCH_CHECK(isOpen(s, str));
+
+	//? copies snapshot the source phase
+	{
+		T	c(s);
+
+		BENCH_CHECK(isOpen(c, str) && c.to_string() == str);
+		s.lock();
+		c = s;
+		BENCH_CHECK(!isOpen(c, str) && !std::strcmp(c.c_str(), str));
+	}
+
+	//? moves: destination decodes, moved-from reads as "" (its
+	//? to_string() keeps size() NUL characters)
+	{
+		const std::string	empty(n, '\0');
+		T					c(s);
+		T					m(std::move(c));
+
+		BENCH_CHECK(!std::strcmp(m.c_str(), str));
+		BENCH_CHECK(!std::strlen(c.c_str()) && c.to_string() == empty);
+		c.lock();
+		c.unlock();
+		BENCH_CHECK(!std::strlen(c.c_str()));
+		c = std::move(m);
+		BENCH_CHECK(c.to_string() == str);
+		BENCH_CHECK(!std::strlen(m.c_str()) && m.to_string() == empty);
+	}
+
+	//? reallocation moves the elements
+	{
+		std::vector<T>	vec;
+
+		for (int i = 0; i < 9; ++i)
+			vec.push_back(s);
+		for (T& o : vec)
+			BENCH_CHECK(o.to_string() == str);
+	}
+	BENCH_CHECK(s.to_string() == str);
+}
+
+#define CHECK_STRING(str) \
+	{ auto l = OBF_L(str); checkStringOne("LIGHT", l, str); \
+	  auto h = OBF_H(str); checkStringOne("HEAVY", h, str); \
+	  auto r = OBFX(str, false, svxor::KS_REGEN); checkStringOne("LIGHT regen", r, str); \
+	  auto c = OBFX(str, true, svxor::KS_REGEN | svxor::KS_CTR); checkStringOne("HEAVY regen ctr", c, str); }
+
+static void benchStringCheck(void)
+{
+	const size_t	before = g_failed;
+
+	CHECK_STRING(BENCH_S8)
+	CHECK_STRING(BENCH_S128)
+	if (!g_json)
+		std::printf("%s\n", (g_failed == before) ? "ok" : "FAILED");
+}
+
+// =========================
+// svxor::snprintf / fprintf / operator<< vs OBF_LONCE
+// =========================
+
+//? discards everything, no allocation
+class NullBuf : public std::streambuf
+{
+protected:
+	std::streamsize xsputn(const char*, std::streamsize n) { return (n); }
+	int overflow(int c) { return (c); }
+};
+
+static void benchIo(void)
+{
+	static char		buf[256];
+	static NullBuf	nb;
+	static FILE*	null = std::fopen("/dev/null", "w");
+	std::ostream	os(&nb);
+
+	report("snprintf(buf, \"%s=%d\")", 0, measure([] { g_sink = g_sink + size_t(std::snprintf(buf, sizeof(buf), "%s=%d", "retries", 42)); }));
+	report("snprintf(buf, OBF_LONCE x2)", 0, measure([] { g_sink = g_sink + size_t(std::snprintf(buf, sizeof(buf), OBF_LONCE("%s=%d"), OBF_LONCE("retries"), 42)); }));
+	report("svxor::snprintf(OBF_FMT x2)", 0, measure([] { g_sink = g_sink + size_t(svxor::snprintf(buf, sizeof(buf), OBF_FMT("%s=%d"), OBF_FMT("retries"), 42)); }));
+	if (null)
+	{
+		report("fprintf(OBF_LONCE x2)", 0, measure([] { g_sink = g_sink + size_t(std::fprintf(null, OBF_LONCE("%s=%d\n"), OBF_LONCE("retries"), 42)); }));
+		report("svxor::fprintf(OBF_FMT x2)", 0, measure([] { g_sink = g_sink + size_t(svxor::fprintf(null, OBF_FMT("%s=%d\n"), OBF_FMT("retries"), 42)); }));
+	}
+	report("ostream << OBF_LONCE(32 B)", 32, measure([&os] { os << OBF_LONCE(BENCH_S32); }));
+	report("ostream << OBF_FMT(32 B)", 32, measure([&os] { os << OBF_FMT(BENCH_S32); }));
+	report("svxor::fprintf(ostream, OBF_FMT x2)", 0, measure([&os] { g_sink = g_sink + size_t(svxor::fprintf(os, OBF_FMT("%s=%d\n"), OBF_FMT("retries"), 42)); }));
+}
+
+// =========================
+// OBF_W / OBF_U16 / OBF_U32 vs OBF at the same byte length
+// =========================
+
+#define BENCH_WIDE(label, o) \
+	{ \
+		auto s = o; \
+		report(label " c_str + lock", s.size() * sizeof(s.c_str()[0]), measure([&] { g_sink = g_sink + size_t(s.c_str()[0]); s.lock(); })); \
+	}
+
+static void benchWide(void)
+{
+	BENCH_WIDE("OBF_L char", OBF_L(BENCH_S128))
+	BENCH_WIDE("OBF_U16 char16_t", OBF_U16(u"" BENCH_S32 BENCH_S32, false))
+	BENCH_WIDE("OBF_U32 char32_t", OBF_U32(U"" BENCH_S32, false))
+	BENCH_WIDE("OBF_W wchar_t", OBF_W(L"" BENCH_S32, false))
+	BENCH_WIDE("OBF_H char", OBF_H(BENCH_S128))
+	BENCH_WIDE("OBF_U32 heavy", OBF_U32(U"" BENCH_S32, true))
+}
+
+// =========================
+// OBF_EQ vs strcmp(OBF_LONCE())
+// =========================
+
+//? equals() on a static object, with the KS_CTR keystream
+#ifndef __SNC__
+# define BENCH_EQ_CTR(str, n) \
+	report("equals (KS_CTR regen)", n, measure([] { static auto o = OBFX(str, false, svxor::KS_CTR | svxor::KS_REGEN); g_sink = g_sink + size_t(o.equals(hit)); }));
+#else
+# define BENCH_EQ_CTR(str, n)
+#endif
+
+#define BENCH_EQ(str) \
+	{ \
+		static const char	hit[] = str; \
+		static char			miss[] = str; \
+		const size_t		n = sizeof(str) - 1; \
+		miss[0] ^= 1; \
+		report("strcmp(OBF_LONCE)", n, measure([] { g_sink = g_sink + size_t(std::strcmp(hit, OBF_LONCE(str)) == 0); })); \
+		report("OBF_EQ", n, measure([] { g_sink = g_sink + size_t(OBF_EQ(hit, str)); })); \
+		report("OBF_EQ_CT", n, measure([] { g_sink = g_sink + size_t(OBF_EQ_CT(hit, str)); })); \
+		BENCH_EQ_CTR(str, n) \
+		report("OBF_EQ miss@0", n, measure([] { g_sink = g_sink + size_t(OBF_EQ(miss, str)); })); \
+	}
+
+static void benchEquals(void)
+{
+	BENCH_EQ(BENCH_S8)
+	BENCH_EQ(BENCH_S32)
+	BENCH_EQ(BENCH_S128)
+	BENCH_EQ(BENCH_S512)
+}
+
+// =========================
+// name -> id: OBF_SWITCH vs strcmp(OBF_LONCE()) chain
+// =========================
+
+#define BENCH_MODULE_NAME(id, fname, s) s,
+#define BENCH_MODULE_CMP(id, fname, s) if (!std::strcmp(name, OBF_LONCE(s))) return (id);
+#define BENCH_MODULE_CASE(id, fname, s) OBF_CASE(s) return (id);
+
+static const char*	g_names[] = { SVXOR_MODULES(BENCH_MODULE_NAME) };
+
+static int nameChain(const char* name)
+{
+	SVXOR_MODULES(BENCH_MODULE_CMP)
+	return (-1);
+}
+
+static int nameSwitch(const char* name)
+{
+	OBF_SWITCH(name)
+	{
+		SVXOR_MODULES(BENCH_MODULE_CASE)
+		default: break;
+	}
+	return (-1);
+}
+
+static void benchNameSwitch(void)
+{
+	static const size_t	count = sizeof(g_names) / sizeof(g_names[0]);
+	static size_t		i = 0;
+
+	report("strcmp(OBF_LONCE) chain", 0, measure([] { g_sink = g_sink + size_t(nameChain(g_names[i = (i + 1) % count])); }));
+	report("OBF_SWITCH / OBF_CASE", 0, measure([] { g_sink = g_sink + size_t(nameSwitch(g_names[i = (i + 1) % count])); }));
+	report("OBF_SWITCH / OBF_CASE_V", 0, measure([] { g_sink = g_sink + size_t(staticObfId(g_names[i = (i + 1) % count])); }));
+	report("chain, unknown name", 0, measure([] { g_sink = g_sink + size_t(nameChain("cellUnknownModule")); }));
+	report("OBF_CASE_V, unknown name", 0, measure([] { g_sink = g_sink + size_t(staticObfId("cellUnknownModule")); }));
+}
+
+//? ============================================================
+//? Self-check: OBF_SWITCH in two TUs (two BUILD_KEYs) linked
+//? together, each must resolve its own labels. Needs
+//? bench/svxor_bench_tu.cpp on the command line.
+//? ============================================================
+int benchOtherTuId(const char* name);
+
+static void benchSwitchTu(void)
+{
+	struct { const char* name; int id; } const	names[] =
+	{
+		{ "sys_net", 0x0000 }, { "cellHttp", 0x0001 }, { "cellSsl", 0x0003 },
+		{ "cellAtracMulti", 0xf054 }, { "cellUnknownModule", -1 }
+	};
+	const size_t	before = g_failed;
+
+	for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); ++i)
+	{
+		const int	a = staticObfId(names[i].name);
+		const int	b = benchOtherTuId(names[i].name);
+
+		if (a != names[i].id || b != names[i].id)
+		{
+			std::fprintf(stderr, "switch_tu: %s: this TU %d, other TU %d, expected %d\n", names[i].name, a, b, names[i].id);
+			++g_failed;
+		}
+	}
+	if (!g_json)
+		std::printf("%s\n", (g_failed == before) ? "ok" : "FAILED");
+}
+
+// =========================
+// OBF_INT / OBF_ARRAY vs atoi / memcpy from a decoded ObfString
+// =========================
+
+#define BENCH_IDS		0x0001, 0x0006, 0x000a, 0x000b, 0x0013, 0x0014, 0x0016, 0x0017, \
+						0x0018, 0x0019, 0x001b, 0xf02f, 0xf030, 0xf034, 0xf035, 0xf054
+#define BENCH_IDS_U32	U"\x0001" U"\x0006" U"\x000a" U"\x000b" U"\x0013" U"\x0014" U"\x0016" U"\x0017" \
+						U"\x0018" U"\x0019" U"\x001b" U"\xf02f" U"\xf030" U"\xf034" U"\xf035" U"\xf054"
+
+static void benchInt(void)
+{
+	static size_t	i = 0;
+
+	report("plain constant", 0, measure([] { g_sink = g_sink + size_t(0xf054); }));
+	report("OBF_INT", 0, measure([] { g_sink = g_sink + size_t(OBF_INT(0xf054)); }));
+	report("OBF_INT uint64_t", 0, measure([] { g_sink = g_sink + size_t(OBF_INT(uint64_t(0xf054f054f054f054ULL))); }));
+	report("atoi(OBF_LONCE)", 0, measure([] { g_sink = g_sink + size_t(std::atoi(OBF_LONCE("61524"))); }));
+	report("OBF_ARRAY[i] (16 x uint32_t)", 4, measure([] { g_sink = g_sink + OBF_ARRAY(uint32_t, { BENCH_IDS })[i++ & 15]; }));
+	report("OBF_U32 c_str + memcpy + lock, [i]", 4, measure([] {
+		static auto	o = OBF_U32(BENCH_IDS_U32, false);
+		uint32_t	t[16];
+
+		std::memcpy(t, o.c_str(), sizeof(t));
+		o.lock();
+		g_sink = g_sink + t[i++ & 15];
+	}));
+	report("OBF_ARRAY decode_to (16 x uint32_t)", 64, measure([] { uint32_t t[16]; OBF_ARRAY(uint32_t, { BENCH_IDS }).decode_to(t, 16); g_sink = g_sink + t[i++ & 15]; }));
+}
+
+// =========================
+// ObfBlob: random reads / streaming
+// =========================
+
+#ifdef SVXOR_HAS_BLOB
+# define BENCH_S4K	BENCH_S512 BENCH_S512 BENCH_S512 BENCH_S512 BENCH_S512 BENCH_S512 BENCH_S512 BENCH_S512
+# define BENCH_S32K	BENCH_S4K BENCH_S4K BENCH_S4K BENCH_S4K BENCH_S4K BENCH_S4K BENCH_S4K BENCH_S4K
+
+OBF_BLOB_STR(g_blob, BENCH_S32K);
+
+static void benchBlob(void)
+{
+	static char		dst[4096];
+	static size_t	off = 0;
+	const size_t	sizes[] = { 16, 64, 256, 4096 };
+
+	for (size_t n : sizes)
+		report("read", n, measure([n] { off = (off + 4099) % (g_blob.size() - n); g_sink = g_sink + g_blob.read(off, n, dst); }));
+	report("stream", g_blob.size(), measure([] { g_blob.stream([](const char* p, size_t n) { g_sink = g_sink + size_t(p[n - 1]); }); }));
+}
+#endif
+
+// =========================
+// REGISTRY: bulk unlock / lock
+// =========================
+
+#ifdef SVXOR_HAS_REGISTRY
+//? hand-written pass over the OBF_STC lookup objects
+#define BENCH_MODULE_LOCK(id, fname, s) obf_c_##fname().lock();
+
+static void relockConst(void)
+{
+	for (int id : g_moduleIds)
+		g_sink = g_sink + size_t(lookupConst(id)[0]);
+	SVXOR_MODULES(BENCH_MODULE_LOCK)
+}
+
+static void benchRegistry(void)
+{
+	const size_t	n = svxor::registry_size();
+	const Sample	all = measure([] { svxor::unlock_all(); svxor::lock_all(); });
+	const Sample	hand = measure([] { relockConst(); });
+	const Sample	per = { all.ns / double(n), all.cycles / double(n) };
+	const double	count = double(sizeof(g_moduleIds) / sizeof(g_moduleIds[0]));
+	const Sample	perHand = { hand.ns / count, hand.cycles / count };
+
+	report("unlock_all + lock_all (" + std::to_string(n) + " objects)", 0, all);
+	report("  per object", 0, per);
+	report("switch + lock(), per object", 0, perHand);
+}
+#endif
+
+// =========================
+// TTL: hot access vs explicit unlock / lock
+// =========================
+
+#ifdef SVXOR_HAS_TTL
+OBF_STTL(t_hot, BENCH_S32, 100)
+OBF_STCL(t_plain, BENCH_S32)
+OBF_STCL(t_relock, BENCH_S32)
+
+static void benchTtl(void)
+{
+	svxor::ttl_start();
+	report("OBF_STT c_str() (hot, ttl running)", 32, measure([] { g_sink = g_sink + size_t(obf_t_hot().c_str()[0]); }));
+	report("OBF_STC c_str() (never relocked)", 32, measure([] { g_sink = g_sink + size_t(obf_t_plain().c_str()[0]); }));
+	report("OBF_STC c_str() + lock() per access", 32, measure([] { g_sink = g_sink + size_t(obf_t_relock().c_str()[0]); obf_t_relock().lock(); }));
+	svxor::ttl_stop();
+}
+#endif
+
+// =========================
+// MAIN
+// =========================
+
+struct Section
+{
+	const char*	name;
+	void		(*fn)(void);
+};
+
+static const Section g_sections[] =
+{
+	{ "xor_kernel", benchXorKernel },
+	{ "modes", benchModes },
+	{ "dtor", benchDtor },
+	{ "static_lookup", benchStaticLookup },
+	{ "static_obfx", benchStaticObfx },
+	{ "static_obfx_mt", benchStaticObfxThreads },
+	{ "once_stress", benchOnceStress },
+	{ "neighbours", benchNeighbours },
+	{ "decode_to", benchDecodeTo },
+	{ "partial", benchPartial },
+	{ "string", benchString },
+	{ "string_check", benchStringCheck },
+	{ "io", benchIo },
+	{ "wide", benchWide },
+	{ "obf_eq", benchEquals },
+	{ "obf_switch", benchNameSwitch },
+	{ "switch_tu", benchSwitchTu },
+	{ "int", benchInt },
+#ifdef SVXOR_HAS_BLOB
+	{ "blob", benchBlob },
+#endif
+#ifdef SVXOR_HAS_REGISTRY
+	{ "registry", benchRegistry },
+#endif
+#ifdef SVXOR_HAS_TTL
+	{ "ttl", benchTtl },
+#endif
+};
+
+//? ============================================================
+//? svxor_bench [--json] [section...]
+//?
+//? --json: machine-readable output only (stdout)
+//? built with -DSVXOR_INSTRUMENT: per-site CSV on stderr
+//? section names restrict the run (default: all)
+//? ============================================================
+int main(int argc, char** argv)
+{
+	std::vector<const char*> only;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		if (!std::strcmp(argv[i], "--json"))
+			g_json = true;
+		else
+			only.push_back(argv[i]);
+	}
+	for (const Section& sec : g_sections)
+	{
+		bool run = only.empty();
+
+		for (const char* o : only)
+			run = run || !std::strcmp(o, sec.name);
+		if (!run)
+			continue;
+		g_section = sec.name;
+		if (!g_json)
+			std::printf("===== %s =====\n", sec.name);
+		sec.fn();
+		if (!g_json)
+			std::printf("\n");
+	}
+	if (g_json)
+		printJson();
+	else
+		std::printf("sink (ignore): %zu\n", size_t(g_sink));
+#ifdef SVXOR_INSTRUMENT
+	svxor::stats_csv(stderr);
+#endif
+	return (g_failed ? 1 : 0);
+}
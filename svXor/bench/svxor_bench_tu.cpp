@@ -0,0 +1,28 @@
+/*
+ * MIT License
+ * Copyright © 2026 NyTekCFW
+ * See LICENSE file for details.
+*/
+
+//? ============================================================
+//? Second translation unit of svxor_bench (switch_tu section)
+//?
+//? Another __FILE__, so another BUILD_KEY than svxor_bench.cpp:
+//? the OBF_SWITCH below must still match its own OBF_CASE labels
+//? whichever TU's inline functions the linker kept.
+//? ============================================================
+
+#include "../svxor.hpp"
+
+int benchOtherTuId(const char* name)
+{
+	OBF_SWITCH(name)
+	{
+		OBF_CASE("sys_net") return (0x0000);
+		OBF_CASE("cellHttp") return (0x0001);
+		OBF_CASE_V("cellSsl") return (0x0003);
+		OBF_CASE_V("cellAtracMulti") return (0xf054);
+		default: break;
+	}
+	return (-1);
+}
@@ -11,6 +11,176 @@
 
 # include <cstdint>
 # include <cstddef>
+# include <cstring>
+# include <atomic>
+# include <string>
+# include <type_traits>
+# include <thread>
+
+# if defined(__AVX2__)
+#  include <immintrin.h>
+#  define SVXOR_AVX2 1
+# endif
+# if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#  include <emmintrin.h>
+#  define SVXOR_SSE2 1
+# endif
+
+//? ============================================================
+//? Optimization barrier
+//?
+//? Makes the compiler forget what it knows about the memory
+//? behind p, so an xor pass can't be constant-folded into the
+//? plaintext. Compilers without one fall back to volatile loops.
+//? ============================================================
+# if defined(__GNUC__) || defined(__clang__)
+#  define SVXOR_BARRIER(p) __asm__ __volatile__("" : : "r"(p) : "memory")
+# elif defined(_MSC_VER)
+#  include <intrin.h>
+#  define SVXOR_BARRIER(p) _ReadWriteBarrier()
+# else
+#  define SVXOR_NO_BARRIER 1
+#  define SVXOR_BARRIER(p) ((void)(p))
+# endif
+
+//? ============================================================
+//? Value barrier
+//?
+//? The variable v keeps its value but the compiler no longer
+//? knows it (OBF_INT ciphertexts, OBF_ARRAY pointers). Free with
+//? GCC / Clang (register constraint), a volatile round trip
+//? elsewhere.
+//? ============================================================
+# if defined(__GNUC__) || defined(__clang__)
+#  define SVXOR_OPAQUE(v) __asm__("" : "+r"(v))
+# else
+#  define SVXOR_OPAQUE(v) ((v) = *static_cast<volatile decltype(v)*>(&(v)))
+# endif
+
+//? ============================================================
+//? Target byte order (wide literals, counter-mode words)
+//? ============================================================
+# if (defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)) || defined(__BIG_ENDIAN__)
+#  define SVXOR_BIG_ENDIAN 1
+# endif
+
+//? ============================================================
+//? Force inlining
+//?
+//? Used on the encrypting constructor: once outlined (several
+//? temporaries of the same type) it reads the literal at run
+//? time and the plaintext ends up in .rodata.
+//? ============================================================
+# if defined(__GNUC__) || defined(__clang__)
+#  define SVXOR_FORCEINLINE inline __attribute__((always_inline))
+# elif defined(_MSC_VER)
+#  define SVXOR_FORCEINLINE __forceinline
+# else
+#  define SVXOR_FORCEINLINE inline
+# endif
+
+//? ============================================================
+//? Full unroll of a short constant-count loop (diffStr: one
+//? test and one constant shift per input character)
+//? ============================================================
+# if defined(__clang__)
+#  define SVXOR_UNROLL _Pragma("unroll")
+# elif defined(__GNUC__) && (__GNUC__ >= 8)
+#  define SVXOR_UNROLL _Pragma("GCC unroll 8")
+# else
+#  define SVXOR_UNROLL
+# endif
+
+//? ============================================================
+//? Encoding backend
+//?
+//? C++14 +: ObfString<Length<N>>, constexpr loop constructor.
+//? C++11 (or SVXOR_INDEX_BACKEND): ObfString<IndexList<0..N-1>>,
+//? pack expansion constructor.
+//? ============================================================
+# if ((__cplusplus >= 201402L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 201402L))) && !defined(SVXOR_INDEX_BACKEND)
+#  define SVXOR_LOOP_BACKEND 1
+# endif
+
+//? ============================================================
+//? decode_chunks() stack buffer size
+//? ============================================================
+# ifndef SVXOR_CHUNK
+#  define SVXOR_CHUNK 64
+# endif
+
+//? ============================================================
+//? Cache line size (ALIGN_LINE, Layout)
+//? ============================================================
+# ifndef SVXOR_CACHE_LINE
+#  define SVXOR_CACHE_LINE 64
+# endif
+
+//? ============================================================
+//? constinit when available (C++20), enforces that static
+//? objects are constant-initialized (no dynamic init, no guard)
+//? ============================================================
+# if defined(__cpp_constinit) && (__cpp_constinit >= 201907L)
+#  define SVXOR_HAS_CONSTINIT 1
+#  define SVXOR_CONSTINIT constinit
+# else
+#  define SVXOR_CONSTINIT
+# endif
+
+//? ============================================================
+//? std::basic_string_view (C++17), see ObfString::View
+//? ============================================================
+# if (__cplusplus >= 201703L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 201703L))
+#  define SVXOR_HAS_STRING_VIEW 1
+#  include <string_view>
+# endif
+
+//? ============================================================
+//? Static object registry (ELF, GCC / Clang)
+//?
+//? Static objects drop a descriptor into the svxor_reg section,
+//? the linker's __start_ / __stop_ symbols bound the array.
+//? aligned() pins the stride: without it the compiler may pad
+//? section entries to its preferred data alignment.
+//? Descriptors declared in inline functions / templates are
+//? COMDAT (one copy per link) and GCC refuses to mix them with
+//? plain ones in a section: they go to svxor_reg_inline.
+//? Define SVXOR_NO_REGISTRY to opt out.
+//? ============================================================
+# if defined(__ELF__) && (defined(__GNUC__) || defined(__clang__)) && !defined(__SNC__) && !defined(SVXOR_NO_REGISTRY)
+#  define SVXOR_HAS_REGISTRY 1
+#  define SVXOR_REG_SECTION __attribute__((used, section("svxor_reg"), aligned(sizeof(void*))))
+#  define SVXOR_REG_SECTION_INLINE __attribute__((used, section("svxor_reg_inline"), aligned(sizeof(void*))))
+# endif
+
+//? ============================================================
+//? Minimum registry entries per thread (lock_all / unlock_all)
+//? ============================================================
+# ifndef SVXOR_REG_GRAIN
+#  define SVXOR_REG_GRAIN 256
+# endif
+
+//? ============================================================
+//? Per call site instrumentation, off by default
+//? (see svxor_instrument.hpp)
+//?
+//? SVXOR_STAT(...) compiles its statement only when enabled,
+//? SVXOR_SITE_* thread the Site pointer through the ctors.
+//? ============================================================
+# ifdef SVXOR_INSTRUMENT
+#  include "./svxor_instrument.hpp"
+#  define SVXOR_STAT(...) __VA_ARGS__
+#  define SVXOR_SITE_PARAM , svxor::Site* site
+#  define SVXOR_SITE_PARAM_DEF , svxor::Site* site = nullptr
+#  define SVXOR_SITE_ARG , site
+#  define SVXOR_SITE_INIT , _site(site), _since(0)
+# else
+#  define SVXOR_STAT(...)
+#  define SVXOR_SITE_PARAM
+#  define SVXOR_SITE_PARAM_DEF
+#  define SVXOR_SITE_ARG
+#  define SVXOR_SITE_INIT
+# endif
 
 
 namespace svxor
@@ -98,6 +268,28 @@ namespace svxor
 		using type = IndexList<0>;
 	};
 
+	//? ============================================================
+	//? Length-only key (C++14 constexpr backend)
+	//?
+	//? Strings of the same length share one ObfString type, no
+	//? index pack: the constructor encrypts with a constexpr loop.
+	//? ============================================================
+	template<int N> struct Length {};
+
+	template<typename L> struct ListLength;
+
+	template<int... I>
+	struct ListLength<IndexList<I...>>
+	{
+		static constexpr int value = int(sizeof...(I));
+	};
+
+	template<int N>
+	struct ListLength<Length<N>>
+	{
+		static constexpr int value = N;
+	};
+
 
 
 	//? ============================================================
@@ -128,171 +320,2358 @@ namespace svxor
 	}
 
 	//? ============================================================
-	//? Obfuscated string object (RAII)
+	//? 64-bit finalizer (SplitMix64 / Stafford variant 13)
 	//?
-	//? Stores an xored string in-place.
-	//? unxor and re-xor are explicit and controlled.
+	//? Full avalanche on 64 bits, used for hashing ids and
+	//? deriving sub-keys.
+	//? ============================================================
+	inline constexpr uint64_t mix64c(uint64_t x)
+	{
+		return (x ^ (x >> 31));
+	}
+
+	inline constexpr uint64_t mix64b(uint64_t x)
+	{
+		return (mix64c((x ^ (x >> 27)) * 0x94D049BB133111EBULL));
+	}
+
+	inline constexpr uint64_t mix64(uint64_t x)
+	{
+		return (mix64b((x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL));
+	}
+
+	//? ============================================================
+	//? Salted string hash (OBF_SWITCH case labels)
 	//?
-	//? HEAVY mode:
-	//?  - forces template expansion per character
-	//?  - produces noisier assembly
+	//? fnv1a seeded with BUILD_KEY then mix64: the labels in the
+	//? binary are neither raw FNV values nor stable across builds.
+	//? Never 0 (reserved for "no match").
+	//? hashStr() is the compile-time form, hashBytes() the runtime
+	//? one (same value for the same bytes). The seed is passed by
+	//? the macros: BUILD_KEY differs per TU, an inline function
+	//? reading it would hash with whichever TU the linker kept.
+	//? ============================================================
+	inline constexpr uint64_t hashNz(uint64_t h)
+	{
+		return (h ? h : 1);
+	}
+
+	inline constexpr uint64_t hashStr(uint64_t seed, const char* s)
+	{
+		return (hashNz(mix64(fnv1a(s, 1469598103934665603ULL ^ seed))));
+	}
+
+	inline uint64_t hashBytes(uint64_t seed, const char* s, size_t n)
+	{
+		uint64_t	h = 1469598103934665603ULL ^ seed;
+
+		for (size_t i = 0; i < n; ++i)
+			h = (h ^ uint8_t(s[i])) * 1099511628211ULL;
+		return (hashNz(mix64(h)));
+	}
+
+	//? ============================================================
+	//? Word-wide xor kernel
 	//?
-	//? LIGHT mode:
-	//?  - simple loop
-	//?  - smaller and faster
+	//? dst[i] = src[i] ^ ks[i] over n bytes (dst may be src),
+	//? 32/16 bytes at a time when AVX2/SSE2 are enabled, then
+	//? 8-byte words, then the tail.
+	//? One barrier per call replaces the per-byte volatile
+	//? accesses: the optimizer can't see through the buffer,
+	//? so the plaintext never ends up folded in the binary.
 	//? ============================================================
+	inline void xorBytes(volatile char* vdst, const volatile char* vsrc, const volatile char* vks, size_t n)
+	{
+# ifdef SVXOR_NO_BARRIER
+		for (size_t i = 0; i < n; ++i)
+			vdst[i] = char(vsrc[i] ^ vks[i]);
+# else
+		char*		dst = const_cast<char*>(vdst);
+		const char*	src = const_cast<const char*>(vsrc);
+		const char*	ks = const_cast<const char*>(vks);
+		size_t		i = 0;
 
+		SVXOR_BARRIER(src);
+		SVXOR_BARRIER(ks);
+#  ifdef SVXOR_AVX2
+		for (; i + 32 <= n; i += 32)
+		{
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+			__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ks + i));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_xor_si256(a, b));
+		}
+#  endif
+#  ifdef SVXOR_SSE2
+		for (; i + 16 <= n; i += 16)
+		{
+			__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+			__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ks + i));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_xor_si128(a, b));
+		}
+#  endif
+		for (; i + 8 <= n; i += 8)
+		{
+			uint64_t a, b;
+			std::memcpy(&a, src + i, 8);
+			std::memcpy(&b, ks + i, 8);
+			a ^= b;
+			std::memcpy(dst + i, &a, 8);
+		}
+		for (; i < n; ++i)
+			dst[i] = char(src[i] ^ ks[i]);
+		SVXOR_BARRIER(dst);
+# endif
+	}
 
-	template<typename IndexList, bool isHeavy> class ObfString;
+	//? in place: dst[i] ^= ks[i]
+	inline void xorBytes(volatile char* dst, const volatile char* ks, size_t n)
+	{
+		svxor::xorBytes(dst, dst, ks, n);
+	}
 
-	template<int... Index, bool isHeavy>
-	class ObfString<IndexList<Index...>, isHeavy>
+	//? ============================================================
+	//? Secure wipe
+	//?
+	//? Plain memset (word / vector stores) followed by the barrier:
+	//? the compiler must assume the zeroed bytes are read, so the
+	//? stores can't be dropped as dead (explicit_bzero technique).
+	//? Compilers without a barrier fall back to a volatile loop.
+	//? ============================================================
+	inline void secureWipe(volatile void* vp, size_t n)
 	{
-	private:
-		volatile bool		_locked;
-		volatile uint64_t	_key;
-		volatile char		_data[sizeof...(Index) + 1];
-		volatile char		_ks[sizeof...(Index) + 1];
-	public:
-		//? ========================================================
-		//? Compile-time constructor
-		//?
-		//? - xor the string literal at compile-time
-		//? - Derives a unique key using BUILD_KEY + salt
-		//? ========================================================
-		inline constexpr ObfString(const char* s, uint64_t salt) : _locked(true), _key(salt), _data{ xorChar(s[Index], salt, Index)... }, _ks{ getKeyStream(salt, Index)... } {}
+# ifdef SVXOR_NO_BARRIER
+		volatile char*	p = static_cast<volatile char*>(vp);
 
-		//? ========================================================
-		//? unlock the string (unxor)
-		//?
-		//? Safe to call multiple times.
-		//? ========================================================
-		inline volatile char* unlock(void)
+		for (size_t i = 0; i < n; ++i)
+			p[i] = 0;
+# else
+		void*	p = const_cast<void*>(vp);
+
+		std::memset(p, 0, n);
+		SVXOR_BARRIER(p);
+# endif
+	}
+
+	//? ============================================================
+	//? Keystream regeneration kernel
+	//?
+	//? mix(k, i) only depends on i through its low byte:
+	//?   mix(k, i) == uint8(mix(k, 0) + i * 0x4E)
+	//? so the stream is rebuilt 16/8 bytes at a time with one
+	//? per-lane byte add instead of two multiplies per character.
+	//? dst[i] = src[i] ^ mix(k, pos + i) over n bytes.
+	//? ============================================================
+	inline void xorMix(volatile char* vdst, const volatile char* vsrc, uint64_t k, size_t n, size_t pos = 0)
+	{
+		const uint8_t	base = uint8_t(svxor::mix(k, 0) + pos * 0x4E);
+# ifdef SVXOR_NO_BARRIER
+		for (size_t i = 0; i < n; ++i)
+			vdst[i] = char(vsrc[i] ^ char(uint8_t(base + i * 0x4E)));
+# else
+		char*		dst = const_cast<char*>(vdst);
+		const char*	src = const_cast<const char*>(vsrc);
+		uint8_t		lanes[16];
+		size_t		i = 0;
+
+		for (int j = 0; j < 16; ++j)
+			lanes[j] = uint8_t(base + j * 0x4E);
+		SVXOR_BARRIER(src);
+#  ifdef SVXOR_SSE2
+		__m128i ks = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes));
+		const __m128i step = _mm_set1_epi8(char((16 * 0x4E) & 0xFF));
+		for (; i + 16 <= n; i += 16)
 		{
-			if (_locked)
-			{
-				if (isHeavy)
-				{
-					int dummy[] = { (_data[Index] ^= (((Index & 3) == ((_key >> 5) & 3)) ? svxor::mix(_key, Index) : _ks[Index]), 0)... };
-					(void)dummy;
-				}
-				else
-				{
-					for (int i = 0; i < sizeof...(Index); ++i)
-					{
-						_data[i] ^= _ks[i];
-					}
-				}
-				_data[sizeof...(Index)] = '\0';
-				_locked = false;
-			}
-			return (_data);
+			__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_xor_si128(a, ks));
+			ks = _mm_add_epi8(ks, step);
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), ks);
+#  endif
+		uint64_t w;
+		std::memcpy(&w, lanes, 8);
+		for (; i + 8 <= n; i += 8)
+		{
+			uint64_t a;
+			std::memcpy(&a, src + i, 8);
+			a ^= w;
+			std::memcpy(dst + i, &a, 8);
+			//? per-byte += 8 * 0x4E (0x70 has no high bit, no carry across lanes)
+			w = ((w & 0x7F7F7F7F7F7F7F7FULL) + 0x7070707070707070ULL) ^ (w & 0x8080808080808080ULL);
 		}
+		std::memcpy(lanes, &w, 8);
+		for (size_t j = 0; i < n; ++i, ++j)
+			dst[i] = char(src[i] ^ char(lanes[j]));
+		SVXOR_BARRIER(dst);
+# endif
+	}
 
-		//? ========================================================
-		//? Explicitly re-xor the string
-		//?
-		//? Safe to call multiple times.
-		//? ========================================================
-		inline volatile char* lock(void)
+	//? in place: dst[i] ^= mix(k, i)
+	inline void xorMix(volatile char* dst, uint64_t k, size_t n)
+	{
+		svxor::xorMix(dst, dst, k, n);
+	}
+
+	//? ============================================================
+	//? Ciphertext compare kernels
+	//?
+	//? Return 0 when enc == in ^ keystream over n bytes: the input
+	//? is encrypted on the fly and compared 8 bytes at a time, the
+	//? literal is never decoded.
+	//? ct = false stops at the first differing word, ct = true
+	//? always walks the n bytes (timing only depends on n).
+	//? ============================================================
+	inline uint64_t diffBytes(const volatile char* venc, const char* in, const volatile char* vks, size_t n, bool ct)
+	{
+		uint64_t	d = 0;
+		size_t		i = 0;
+# ifdef SVXOR_NO_BARRIER
+		for (; i < n; ++i)
 		{
-			if (!_locked)
-			{
-				if (isHeavy)
-				{
-					int dummy[] = { (_data[Index] ^= (((Index & 3) == ((_key >> 5) & 3)) ? svxor::mix(_key, Index) : _ks[Index]), 0)... };
-					(void)dummy;
-				}
-				else
-				{
-					for (int i = 0; i < sizeof...(Index); ++i)
-						_data[i] ^= _ks[i];
-				}
-				_data[sizeof...(Index)] = '\0';
-				_locked = true;
-			}
-			return _data;
+			d |= uint8_t(in[i] ^ vks[i] ^ venc[i]);
+			if (d && !ct)
+				break;
 		}
+# else
+		const char*	enc = const_cast<const char*>(venc);
+		const char*	ks = const_cast<const char*>(vks);
 
-		//? ========================================================
-		//? alias for unxor()
-		//? ========================================================
-		inline const char* c_str(void)
+		SVXOR_BARRIER(enc);
+		SVXOR_BARRIER(ks);
+		for (; i + 8 <= n; i += 8)
 		{
-			return (const_cast<const char*>(this->unlock()));
+			uint64_t a, b, c;
+			std::memcpy(&a, in + i, 8);
+			std::memcpy(&b, ks + i, 8);
+			std::memcpy(&c, enc + i, 8);
+			d |= (a ^ b) ^ c;
+			if (d && !ct)
+				return (d);
 		}
+		for (; i < n; ++i)
+			d |= uint8_t((in[i] ^ ks[i]) ^ enc[i]);
+# endif
+		return (d);
+	}
 
-		inline const char* c_data(void)
+	//? unlocked object: plain compare, same early-out / ct rules
+	inline uint64_t diffBytes(const volatile char* vplain, const char* in, size_t n, bool ct)
+	{
+		uint64_t	d = 0;
+		size_t		i = 0;
+# ifdef SVXOR_NO_BARRIER
+		for (; i < n; ++i)
 		{
-			return (const_cast<const char*>(this->_data));
+			d |= uint8_t(in[i] ^ vplain[i]);
+			if (d && !ct)
+				break;
 		}
+# else
+		const char*	plain = const_cast<const char*>(vplain);
 
-		//? ========================================================
-		//? Destructor
-		//?
-		//? Clears buffer and key to reduce memory residue.
-		// ========================================================
-		~ObfString(void)
+		SVXOR_BARRIER(plain);
+		for (; i + 8 <= n; i += 8)
 		{
-			_key = 0;
-			for (size_t i = 0; i < sizeof...(Index); ++i)
-			{
-				_data[i] = 0;
-				_ks[i] = 0;
-			}
-			_data[sizeof...(Index)] = 0;
-			_ks[sizeof...(Index)] = 0;
+			uint64_t a, c;
+			std::memcpy(&a, in + i, 8);
+			std::memcpy(&c, plain + i, 8);
+			d |= a ^ c;
+			if (d && !ct)
+				return (d);
 		}
-	};
-	template <typename T, bool heavy>
-	struct ObfHolder
+		for (; i < n; ++i)
+			d |= uint8_t(in[i] ^ plain[i]);
+# endif
+		return (d);
+	}
+
+	//? regenerated keystream (see xorMix)
+	inline uint64_t diffMix(const volatile char* venc, const char* in, uint64_t k, size_t n, bool ct)
 	{
-		static svxor::ObfString<T, heavy>& get(const char* s, uint64_t key)
+		const uint8_t	base = svxor::mix(k, 0);
+		uint64_t		d = 0;
+		size_t			i = 0;
+# ifdef SVXOR_NO_BARRIER
+		for (; i < n; ++i)
 		{
-			static svxor::ObfString<T, heavy> obj(s, key);
-			return (obj);
+			d |= uint8_t(in[i] ^ char(uint8_t(base + i * 0x4E)) ^ venc[i]);
+			if (d && !ct)
+				break;
 		}
-	};
-}
+# else
+		const char*	enc = const_cast<const char*>(venc);
+		uint8_t		lanes[8];
+		uint64_t	w;
 
-//! ============================================================
-//! MACROS
-//! ============================================================
+		for (int j = 0; j < 8; ++j)
+			lanes[j] = uint8_t(base + j * 0x4E);
+		std::memcpy(&w, lanes, 8);
+		SVXOR_BARRIER(enc);
+		for (; i + 8 <= n; i += 8)
+		{
+			uint64_t a, c;
+			std::memcpy(&a, in + i, 8);
+			std::memcpy(&c, enc + i, 8);
+			d |= (a ^ w) ^ c;
+			if (d && !ct)
+				return (d);
+			w = ((w & 0x7F7F7F7F7F7F7F7FULL) + 0x7070707070707070ULL) ^ (w & 0x8080808080808080ULL);
+		}
+		std::memcpy(lanes, &w, 8);
+		for (; i < n; ++i)
+			d |= uint8_t((in[i] ^ char(lanes[i & 7])) ^ enc[i]);
+# endif
+		return (d);
+	}
 
-//? ============================================================
-//? RAII object (stack-based, safe lifetime)
-//? ============================================================
-# define OBF(s, heavy) (svxor::ObfString<svxor::MakeIndex<sizeof(s) - 1>::type, heavy>(s, svxor::BUILD_KEY ^ (uint64_t(__COUNTER__) * 0x9E3779B97F4A7C15ULL)))
-# define OBF_H(s) OBF(s, true)
-# define OBF_L(s) OBF(s, false)
+	//? ============================================================
+	//? Counter-mode keystream (KS_CTR)
+	//?
+	//? Word j = mix64(k + j * golden) (SplitMix64), byte i of the
+	//? stream is byte (i & 7) of word (i >> 3): 8 bytes per 64-bit
+	//? round instead of one, and any offset is reachable without
+	//? generating what precedes it. Also used by svxor_blob.hpp.
+	//? ============================================================
+	inline constexpr uint64_t ctrWord(uint64_t k, uint64_t j)
+	{
+		return (mix64(k + j * 0x9E3779B97F4A7C15ULL));
+	}
 
-//? ============================================================
-//? One-shot helper (INTENTIONALLY UB lifetime)
-//?
-//? Intended for immediate use only (printf, comparisons, etc).
-//? ============================================================
-# define OBF_ONCE(s, heavy) OBF(s, heavy).c_str()
-# define OBF_HONCE(s) OBF_ONCE(s, true)
-# define OBF_LONCE(s) OBF_ONCE(s, false)
+	inline constexpr char ctrByte(uint64_t k, size_t i)
+	{
+		return (char(uint8_t(ctrWord(k, i >> 3) >> ((i & 7) * 8))));
+	}
 
-//# define __SNC__ 1
-# ifndef __SNC__
-//? ============================================================
-//? Static RAII object supported (non-SNC compiler)
-//? ============================================================
+	//? ============================================================
+	//? Keystream byte b of a word is (word >> 8b): same byte order
+	//? as a little-endian load, swapped on big-endian targets.
+	//? ============================================================
+	inline uint64_t ctrLe(uint64_t w)
+	{
+# ifdef SVXOR_BIG_ENDIAN
+		w = ((w & 0x00FF00FF00FF00FFULL) << 8) | ((w >> 8) & 0x00FF00FF00FF00FFULL);
+		w = ((w & 0x0000FFFF0000FFFFULL) << 16) | ((w >> 16) & 0x0000FFFF0000FFFFULL);
+		w = (w << 32) | (w >> 32);
+# endif
+		return (w);
+	}
 
-#  define OBF_ST(fname, s, heavy) static svxor::ObfString<svxor::MakeIndex<sizeof(s) - 1>::type, heavy>&	obf_##fname(void){static svxor::ObfString<svxor::MakeIndex<sizeof(s) - 1>::type, heavy> s_##fname = OBF(s, heavy); return (s_##fname);}
-#  define OBF_STL(fname, s) OBF_ST(fname, s, false)
-#  define OBF_STH(fname, s) OBF_ST(fname, s, true)
+# ifdef SVXOR_AVX2
+	//? ============================================================
+	//? mix64 on 4 counters at once
+	//?
+	//? AVX2 has no 64-bit multiply: lo * lo + (cross terms << 32)
+	//? out of three 32x32->64 products.
+	//? ============================================================
+	inline __m256i ctrMul4(__m256i a, uint64_t c)
+	{
+		const __m256i	lo = _mm256_set1_epi64x(int64_t(c & 0xFFFFFFFFULL));
+		const __m256i	hi = _mm256_set1_epi64x(int64_t(c >> 32));
+		const __m256i	cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), lo), _mm256_mul_epu32(a, hi));
 
-# else
-//? ============================================================
-//? SNC compiler: no static RAII objects allowed
-//? Lazy-initialized static char buffer instead
-//? ============================================================
+		return (_mm256_add_epi64(_mm256_mul_epu32(a, lo), _mm256_slli_epi64(cross, 32)));
+	}
 
-#  define OBF_ST(fname, s, heavy) static const char*	obf_##fname(void) {static char s_##fname[sizeof(s)] = { 0 }; if (!s_##fname[0]){ auto obj_##fname = OBF(s, heavy); obj_##fname.unlock(); for (int i = 0; i < sizeof(s); ++i){s_##fname[i] = obj_##fname.c_data()[i];}} return (s_##fname);}
-#  define OBF_STL(fname, s) OBF_ST(fname, s, false)
-#  define OBF_STH(fname, s) OBF_ST(fname, s, true)
-# endif
+	inline __m256i ctrMix4(__m256i x)
+	{
+		x = ctrMul4(_mm256_xor_si256(x, _mm256_srli_epi64(x, 30)), 0xBF58476D1CE4E5B9ULL);
+		x = ctrMul4(_mm256_xor_si256(x, _mm256_srli_epi64(x, 27)), 0x94D049BB133111EBULL);
+		return (_mm256_xor_si256(x, _mm256_srli_epi64(x, 31)));
+	}
+# endif
+
+	//? ============================================================
+	//? dst[i] = src[i] ^ ctrByte(k, pos + i) over n bytes
+	//?
+	//? Partial word up to a word boundary, 4 words per round with
+	//? AVX2, whole words, then the last partial word.
+	//? ============================================================
+	inline void xorCtr(volatile char* vdst, const volatile char* vsrc, uint64_t k, size_t n, size_t pos = 0)
+	{
+# ifdef SVXOR_NO_BARRIER
+		for (size_t i = 0; i < n; ++i)
+			vdst[i] = char(vsrc[i] ^ ctrByte(k, pos + i));
+# else
+		char*		dst = const_cast<char*>(vdst);
+		const char*	src = const_cast<const char*>(vsrc);
+		size_t		i = 0;
+
+		SVXOR_BARRIER(src);
+		if (pos & 7)
+		{
+			const uint64_t	w = ctrWord(k, pos >> 3);
+
+			for (; i < n && ((pos + i) & 7); ++i)
+				dst[i] = char(src[i] ^ char(w >> (((pos + i) & 7) * 8)));
+		}
+#  ifdef SVXOR_AVX2
+		if (i + 32 <= n)
+		{
+			const uint64_t	c = k + uint64_t((pos + i) >> 3) * 0x9E3779B97F4A7C15ULL;
+			const __m256i	step = _mm256_set1_epi64x(int64_t(4 * 0x9E3779B97F4A7C15ULL));
+			__m256i			ctr = _mm256_set_epi64x(int64_t(c + 3 * 0x9E3779B97F4A7C15ULL), int64_t(c + 2 * 0x9E3779B97F4A7C15ULL), int64_t(c + 0x9E3779B97F4A7C15ULL), int64_t(c));
+
+			for (; i + 32 <= n; i += 32)
+			{
+				__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_xor_si256(a, ctrMix4(ctr)));
+				ctr = _mm256_add_epi64(ctr, step);
+			}
+		}
+#  endif
+		for (; i + 8 <= n; i += 8)
+		{
+			uint64_t a;
+			std::memcpy(&a, src + i, 8);
+			a ^= ctrLe(ctrWord(k, (pos + i) >> 3));
+			std::memcpy(dst + i, &a, 8);
+		}
+		if (i < n)
+		{
+			const uint64_t	w = ctrWord(k, (pos + i) >> 3);
+
+			for (int b = 0; b < 8 && i < n; ++i, ++b)
+				dst[i] = char(src[i] ^ char(w >> (b * 8)));
+		}
+		SVXOR_BARRIER(dst);
+# endif
+	}
+
+	//? compare kernel (see diffBytes), counter-mode keystream
+	inline uint64_t diffCtr(const volatile char* venc, const char* in, uint64_t k, size_t n, bool ct)
+	{
+		uint64_t	d = 0;
+		size_t		i = 0;
+# ifdef SVXOR_NO_BARRIER
+		for (; i < n; ++i)
+		{
+			d |= uint8_t(in[i] ^ ctrByte(k, i) ^ venc[i]);
+			if (d && !ct)
+				break;
+		}
+# else
+		const char*	enc = const_cast<const char*>(venc);
+
+		SVXOR_BARRIER(enc);
+		for (; i + 8 <= n; i += 8)
+		{
+			uint64_t a, c;
+			std::memcpy(&a, in + i, 8);
+			std::memcpy(&c, enc + i, 8);
+			d |= (a ^ ctrLe(ctrWord(k, i >> 3))) ^ c;
+			if (d && !ct)
+				return (d);
+		}
+		if (i < n)
+		{
+			const uint64_t	w = ctrWord(k, i >> 3);
+
+			for (int b = 0; b < 8 && i < n; ++i, ++b)
+				d |= uint8_t((in[i] ^ char(w >> (b * 8))) ^ enc[i]);
+		}
+# endif
+		return (d);
+	}
+
+	//? ============================================================
+	//? NUL-terminated input against n bytes of ciphertext
+	//?
+	//? The length check is folded into the walk: each word of the
+	//? input is assembled from its characters (never read past the
+	//? terminator), a NUL before n bytes is a mismatch, then the
+	//? word is compared like diffBytes. ks(buf, pos, m) xors the
+	//? keystream bytes [pos, pos + m) into the zeroed block buf
+	//? (nothing for plaintext), the literal is never decoded.
+	//? ct = true walks every character of s up to n bytes.
+	//? ============================================================
+	template<typename CharT, typename F>
+	inline uint64_t diffStr(const volatile char* venc, const CharT* s, size_t n, const F& ks, bool ct)
+	{
+		typedef typename std::make_unsigned<CharT>::type U;
+		enum : size_t { W = sizeof(CharT) };
+		uint64_t	d = 0;
+		size_t		i = 0;
+
+		//? s[k + 1] is only read when s[k] != 0: hide the caller's
+		//? object, or -Warray-bounds flags an unreachable read
+		SVXOR_OPAQUE(s);
+# ifdef SVXOR_NO_BARRIER
+		const volatile char*	enc = venc;
+# else
+		const char*	enc = const_cast<const char*>(venc);
+
+		SVXOR_BARRIER(enc);
+# endif
+		while (i < n)
+		{
+			const size_t	m = (n - i < 32) ? n - i : 32;
+			char			b[32] = {};
+			size_t			j = 0;
+
+			ks(b, i, m);
+# ifndef SVXOR_NO_BARRIER
+			for (; j + 8 <= m; j += 8)
+			{
+				const CharT*	in = s + (i + j) / W;
+				uint64_t		a = 0, k, c;
+
+				SVXOR_UNROLL
+				for (size_t q = 0; q < 8 / W; ++q)
+				{
+					if (in[q] == CharT(0))
+						return (1);
+#  ifdef SVXOR_BIG_ENDIAN
+					a |= uint64_t(U(in[q])) << ((8 - W - q * W) * 8);
+#  else
+					a |= uint64_t(U(in[q])) << (q * W * 8);
+#  endif
+				}
+				std::memcpy(&k, b + j, 8);
+				std::memcpy(&c, enc + i + j, 8);
+				d |= (a ^ k) ^ c;
+			}
+# endif
+			for (; j < m; j += W)
+			{
+				const CharT	c = s[(i + j) / W];
+				char		in[W];
+
+				if (c == CharT(0))
+					return (1);
+				std::memcpy(in, &c, W);
+				for (size_t w = 0; w < W; ++w)
+					d |= uint8_t((in[w] ^ b[j + w]) ^ enc[i + j + w]);
+			}
+			if (d && !ct)
+				return (d);
+			i += m;
+		}
+		if (s[n / W] != CharT(0))
+			d |= 1;
+		return (d);
+	}
+
+	//? ============================================================
+	//? ObfString options (Flags template parameter)
+	//?
+	//? KS_STORED: default, a copy of the keystream lives next to
+	//?            the ciphertext.
+	//? KS_REGEN:  only the key and the ciphertext are stored, the
+	//?            keystream is regenerated on unlock/lock.
+	//?            Halves the object size and keeps the key stream
+	//?            out of .data.
+	//? HV_CACHED: HEAVY only, _key is read once per pass and the
+	//?            mix() lanes derived from a single mix(k, 0)
+	//?            instead of one full mix() per lane character.
+	//? KS_CTR:    counter-mode keystream (ctrWord) instead of
+	//?            mix(): 8 bytes per 64-bit round, 4 rounds at a
+	//?            time with AVX2. Combines with the other flags.
+	//?
+	//? Destructor wipe policy:
+	//? WIPE_FULL:  default, data, keystream and key are cleared.
+	//? WIPE_PLAIN: only the buffer, and only if it holds plaintext
+	//?             (object still unlocked), ciphertext is left.
+	//? WIPE_NONE:  nothing, for objects always locked before they
+	//?             go out of scope.
+	//?
+	//? Layout:
+	//? LAYOUT_PACKED: 32-bit key next to the 32-bit state word,
+	//?                8-byte header without padding (see KeyWord).
+	//? ALIGN_LINE:    object aligned (and padded) to a cache line,
+	//?                one hot static per line, no false sharing.
+	//? ============================================================
+	enum : uint32_t
+	{
+		KS_STORED		= 0,
+		KS_REGEN		= 1u << 0,
+		HV_CACHED		= 1u << 1,
+		KS_CTR			= 1u << 2,
+		WIPE_FULL		= 0,
+		WIPE_PLAIN		= 1u << 3,
+		WIPE_NONE		= 1u << 4,
+		LAYOUT_PACKED	= 1u << 5,
+		ALIGN_LINE		= 1u << 6
+	};
+
+	//? ============================================================
+	//? Keystream generators, selected by KS_CTR
+	//?
+	//? at():    byte i, constant expression (compile-time side)
+	//? fill():  n bytes of stream (runtime stored keystream)
+	//? xorAt(): dst[i] = src[i] ^ stream[pos + i]
+	//? diff():  compare kernel
+	//? Cache:   per-pass lane source for HEAVY HV_CACHED
+	//? ============================================================
+	template<bool isCtr> struct Cipher;
+
+	template<>
+	struct Cipher<false>
+	{
+		static inline constexpr char at(uint64_t k, size_t i)
+		{
+			return (getKeyStream(k, int(i)));
+		}
+
+		//? mix(k, i) == mix(k, 0) + i * 0x4E: no multiply per byte
+		static inline void fill(char* ks, uint64_t k, size_t n)
+		{
+			const uint8_t	base = svxor::mix(k, 0);
+
+			for (size_t i = 0; i < n; ++i)
+				ks[i] = char(uint8_t(base + i * 0x4E));
+		}
+
+		static inline void xorAt(volatile char* dst, const volatile char* src, uint64_t k, size_t n, size_t pos)
+		{
+			svxor::xorMix(dst, src, k, n, pos);
+		}
+
+		static inline uint64_t diff(const volatile char* enc, const char* in, uint64_t k, size_t n, bool ct)
+		{
+			return (svxor::diffMix(enc, in, k, n, ct));
+		}
+
+		struct Cache
+		{
+			uint8_t	base;
+
+			inline explicit Cache(uint64_t k) : base(svxor::mix(k, 0)) {}
+
+			inline char at(uint64_t, size_t i) const
+			{
+				return (char(uint8_t(base + i * 0x4E)));
+			}
+		};
+	};
+
+	template<>
+	struct Cipher<true>
+	{
+		static inline constexpr char at(uint64_t k, size_t i)
+		{
+			return (ctrByte(k, i));
+		}
+
+		static inline void fill(char* ks, uint64_t k, size_t n)
+		{
+			for (size_t i = 0; i < n; i += 8)
+			{
+				const uint64_t	w = ctrLe(ctrWord(k, i >> 3));
+
+				std::memcpy(ks + i, &w, (n - i < 8) ? (n - i) : 8);
+			}
+		}
+
+		static inline void xorAt(volatile char* dst, const volatile char* src, uint64_t k, size_t n, size_t pos)
+		{
+			svxor::xorCtr(dst, src, k, n, pos);
+		}
+
+		static inline uint64_t diff(const volatile char* enc, const char* in, uint64_t k, size_t n, bool ct)
+		{
+			return (svxor::diffCtr(enc, in, k, n, ct));
+		}
+
+		//? k is a local in the pass: words of the same index fold
+		struct Cache
+		{
+			inline explicit Cache(uint64_t) {}
+
+			inline char at(uint64_t k, size_t i) const
+			{
+				return (ctrByte(k, i));
+			}
+		};
+	};
+
+	//? ============================================================
+	//? Stored key, selected by LAYOUT_PACKED
+	//?
+	//? store():  what the object keeps from the salt
+	//? expand(): stream key rebuilt from it on every pass
+	//? Packed: 32 bits folded from the salt, expanded as k:k.
+	//? ============================================================
+	template<bool isPacked> struct KeyWord;
+
+	template<>
+	struct KeyWord<false>
+	{
+		typedef uint64_t type;
+
+		static inline constexpr type store(uint64_t salt)
+		{
+			return (salt);
+		}
+
+		static inline constexpr uint64_t expand(type k)
+		{
+			return (k);
+		}
+	};
+
+	template<>
+	struct KeyWord<true>
+	{
+		typedef uint32_t type;
+
+		static inline constexpr type store(uint64_t salt)
+		{
+			return (uint32_t(salt ^ (salt >> 32)));
+		}
+
+		static inline constexpr uint64_t expand(type k)
+		{
+			return (uint64_t(k) * 0x100000001ULL);
+		}
+	};
+
+	template<uint32_t Flags>
+	inline constexpr uint64_t streamKey(uint64_t salt)
+	{
+		return (KeyWord<(Flags & LAYOUT_PACKED) != 0>::expand(KeyWord<(Flags & LAYOUT_PACKED) != 0>::store(salt)));
+	}
+
+	//? ============================================================
+	//? Literal bytes in memory order
+	//?
+	//? Objects are encrypted byte by byte whatever the character
+	//? type: byte i of a wide literal is byte i % sizeof(T) of
+	//? element i / sizeof(T), in the target byte order, so the
+	//? decoded buffer is the native wchar_t / char16_t / char32_t
+	//? array and the xor kernels keep their word / SIMD width.
+	//? ============================================================
+	inline constexpr unsigned litShift(size_t width, size_t b)
+	{
+# ifdef SVXOR_BIG_ENDIAN
+		return (unsigned(8 * (width - 1 - b)));
+# else
+		return ((void)width, unsigned(8 * b));
+# endif
+	}
+
+	template<typename T>
+	inline constexpr char litByte(const T* s, size_t i)
+	{
+		return (char(uint8_t(uint64_t(s[i / sizeof(T)]) >> litShift(sizeof(T), i % sizeof(T)))));
+	}
+
+	//? literal type of a character type (OBF_BYTES: "..." -> unsigned char)
+	template<typename CharT> struct LitChar { typedef CharT type; };
+	template<> struct LitChar<unsigned char> { typedef char type; };
+
+	//? ============================================================
+	//? Ciphertext computed in a constant expression (see OBFX,
+	//? OBF_ENCODE): the loop constructor alone isn't folded for
+	//? stack objects. N bytes, terminator excluded.
+	//? ============================================================
+	template<size_t N>
+	struct Encoded
+	{
+		char	d[N + 1];
+	};
+
+	//? ============================================================
+	//? Length of a caller string for the compare paths, scanned
+	//? up to max + 1 characters (longer never matches). A loop,
+	//? not memchr(s, 0, max + 1): the caller's buffer may be
+	//? shorter than the literal.
+	//? ============================================================
+	template<typename CharT>
+	inline size_t inputLength(const CharT* s, size_t max)
+	{
+		size_t	n = 0;
+
+		while (s && n <= max && s[n])
+			++n;
+		return (n);
+	}
+
+	template<uint32_t Flags, typename T, size_t M, int... Index>
+	inline constexpr Encoded<(M - 1) * sizeof(T)> encode(const T (&s)[M], uint64_t salt, IndexList<Index...>)
+	{
+		//? (void)salt: unused for "" (empty pack)
+		return (Encoded<(M - 1) * sizeof(T)>{ { char(litByte(s, Index) ^ Cipher<(Flags & KS_CTR) != 0>::at(streamKey<Flags>(salt), Index))..., ((void)salt, '\0') } });
+	}
+
+# ifdef SVXOR_LOOP_BACKEND
+	template<uint32_t Flags, typename T, size_t M>
+	inline constexpr Encoded<(M - 1) * sizeof(T)> encode(const T (&s)[M], uint64_t salt)
+	{
+		Encoded<(M - 1) * sizeof(T)>	r{};
+		const uint64_t					k = streamKey<Flags>(salt);
+
+		for (size_t i = 0; i < (M - 1) * sizeof(T); ++i)
+			r.d[i] = char(litByte(s, i) ^ Cipher<(Flags & KS_CTR) != 0>::at(k, i));
+		return (r);
+	}
+# endif
+
+	//? ============================================================
+	//? Keystream storage, selected by KS_REGEN
+	//? ============================================================
+	template<int N, bool isStored, typename C> struct KeyStream;
+
+	template<int N, typename C>
+	struct KeyStream<N, true, C>
+	{
+		volatile char	_ks[N + 1];
+
+		//? explicit terminator: (void)k, unused for "" (empty pack)
+		template<int... Index>
+		inline constexpr KeyStream(uint64_t k, IndexList<Index...>) : _ks{ C::at(k, Index)..., ((void)k, '\0') } {}
+
+# ifdef SVXOR_LOOP_BACKEND
+		inline constexpr KeyStream(uint64_t k, Length<N>) : _ks{}
+		{
+			for (size_t i = 0; i < size_t(N); ++i)
+				_ks[i] = C::at(k, i);
+		}
+
+		//? runtime fill (OBFX stack objects), see ObfString(Encoded)
+		inline KeyStream(uint64_t k, const Encoded<N>&)
+		{
+			C::fill(const_cast<char*>(_ks), k, N);
+			_ks[N] = 0;
+		}
+# endif
+
+		//? word copies (the implicit ones go byte by byte)
+		inline KeyStream(const KeyStream& o)
+		{
+			std::memcpy(const_cast<char*>(_ks), const_cast<const char*>(o._ks), N + 1);
+		}
+
+		inline KeyStream& operator=(const KeyStream& o)
+		{
+			std::memcpy(const_cast<char*>(_ks), const_cast<const char*>(o._ks), N + 1);
+			return (*this);
+		}
+
+		inline char keyStream(uint64_t, int i) const
+		{
+			return (_ks[i]);
+		}
+
+		inline void xorWith(volatile char* data, uint64_t)
+		{
+			svxor::xorBytes(data, _ks, N);
+		}
+
+		//? dst[i] = src[i] ^ ks[pos + i]
+		inline void xorAt(char* dst, const volatile char* src, uint64_t, size_t pos, size_t n) const
+		{
+			svxor::xorBytes(dst, src, _ks + pos, n);
+		}
+
+		inline uint64_t diffWith(const volatile char* enc, const char* in, uint64_t, size_t n, bool ct) const
+		{
+			return (svxor::diffBytes(enc, in, _ks, n, ct));
+		}
+
+		inline void wipeKeyStream(void)
+		{
+			svxor::secureWipe(_ks, N + 1);
+		}
+	};
+
+	template<int N, typename C>
+	struct KeyStream<N, false, C>
+	{
+		template<typename L>
+		inline constexpr KeyStream(uint64_t, const L&) {}
+
+		inline char keyStream(uint64_t k, int i) const
+		{
+			return (C::at(k, size_t(i)));
+		}
+
+		inline void xorWith(volatile char* data, uint64_t k)
+		{
+			C::xorAt(data, data, k, N, 0);
+		}
+
+		inline void xorAt(char* dst, const volatile char* src, uint64_t k, size_t pos, size_t n) const
+		{
+			C::xorAt(dst, src, k, n, pos);
+		}
+
+		inline uint64_t diffWith(const volatile char* enc, const char* in, uint64_t k, size_t n, bool ct) const
+		{
+			return (C::diff(enc, in, k, n, ct));
+		}
+
+		inline void wipeKeyStream(void) {}
+	};
+
+	//? ============================================================
+	//? Decode state machine
+	//?
+	//? One atomic word per object:
+	//?  - bits 0-1: phase (LOCKED, BUSY while xoring, UNLOCKED)
+	//?  - bits 2-30: pinned readers (ST_READER per reader)
+	//?  - bit 31  : relock pending (UNLOCKED only), set by a View
+	//?              leaving while other readers are pinned: the
+	//?              last unpin() relocks
+	//? 0 is reserved for zero storage (object not constructed yet).
+	//? A phase change needs the word to be exactly LOCKED or
+	//? UNLOCKED (no readers), readers never block each other.
+	//? ============================================================
+	enum : uint32_t
+	{
+		ST_LOCKED	= 1,
+		ST_BUSY		= 2,
+		ST_UNLOCKED	= 3,
+		ST_PHASE	= 3,
+		ST_READER	= 4,
+		ST_RELOCK	= 1u << 31
+	};
+
+	//? ============================================================
+	//? Spin-wait helper (pause, then yield to the scheduler)
+	//? ============================================================
+	inline void cpuRelax(unsigned& spins)
+	{
+		if (++spins < 64)
+		{
+# if defined(__x86_64__) || defined(__i386__)
+			__builtin_ia32_pause();
+# elif defined(_M_X64) || defined(_M_IX86)
+			_mm_pause();
+# elif defined(__aarch64__)
+			__asm__ __volatile__("yield");
+# endif
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	//? ============================================================
+	//? Once-decode into a static buffer (SNC OBF_ST)
+	//?
+	//? Three-state flag, zero-initialized storage, no C++11 magic
+	//? static: the first caller decodes straight from the
+	//? ciphertext into buf, concurrent callers wait for READY.
+	//? ============================================================
+	enum : uint32_t
+	{
+		ONCE_UNINIT	= 0,
+		ONCE_BUSY	= 1,
+		ONCE_READY	= 2
+	};
+
+	template<uint32_t Flags, size_t N>
+	inline const char* decodeOnce(std::atomic<uint32_t>& once, char* buf, const Encoded<N>& e, uint64_t salt)
+	{
+		uint32_t	s = once.load(std::memory_order_acquire);
+		unsigned	spins = 0;
+
+		if (s == ONCE_READY)
+			return (buf);
+		for (;;)
+		{
+			s = ONCE_UNINIT;
+			if (once.compare_exchange_weak(s, ONCE_BUSY, std::memory_order_acquire, std::memory_order_acquire))
+				break;
+			if (s == ONCE_READY)
+				return (buf);
+			cpuRelax(spins);
+		}
+		//? the barrier keeps the xor from being folded into the
+		//? plaintext (constant ciphertext and key)
+		std::memcpy(buf, e.d, N);
+		SVXOR_BARRIER(buf);
+		Cipher<(Flags & KS_CTR) != 0>::xorAt(buf, buf, streamKey<Flags>(salt), N, 0);
+		buf[N] = '\0';
+		once.store(ONCE_READY, std::memory_order_release);
+		return (buf);
+	}
+
+	//? ============================================================
+	//? Obfuscated string object (RAII)
+	//?
+	//? Stores an xored string in-place.
+	//? unxor and re-xor are explicit and controlled.
+	//?
+	//? HEAVY mode:
+	//?  - forces template expansion per character
+	//?  - produces noisier assembly
+	//?
+	//? LIGHT mode:
+	//?  - word-wide xor kernel (see xorBytes)
+	//?  - smaller and faster
+	//?
+	//? Flags: see KS_STORED / KS_REGEN / HV_CACHED / KS_CTR,
+	//? WIPE_* and LAYOUT_PACKED / ALIGN_LINE.
+	//?
+	//? unlock()/lock()/c_str() are thread-safe: the xor pass runs
+	//? once per transition. Pointers from c_str() are not pinned,
+	//? use read() when another thread may lock() concurrently.
+	//? ============================================================
+
+
+	template<bool B> struct HeavyTag {};
+
+	template<typename L, bool isHeavy, uint32_t Flags = KS_STORED, typename CharT = char>
+	class alignas((Flags & ALIGN_LINE) ? size_t(SVXOR_CACHE_LINE) : alignof(typename KeyWord<(Flags & LAYOUT_PACKED) != 0>::type)) ObfString
+		: private KeyStream<ListLength<L>::value, !(Flags & KS_REGEN), Cipher<(Flags & KS_CTR) != 0>>
+	{
+	private:
+		//? N bytes of W-byte characters (wide literals, see litByte)
+		enum : size_t { N = size_t(ListLength<L>::value), W = sizeof(CharT) };
+
+		typedef typename LitChar<CharT>::type Lit;
+
+		typedef Cipher<(Flags & KS_CTR) != 0> C;
+		typedef KeyStream<ListLength<L>::value, !(Flags & KS_REGEN), C> Ks;
+		typedef KeyWord<(Flags & LAYOUT_PACKED) != 0> Kw;
+
+		std::atomic<uint32_t>			_state;
+		volatile typename Kw::type		_key;
+		alignas(CharT) volatile char	_data[N + W];
+# ifdef SVXOR_INSTRUMENT
+		Site*							_site;
+		uint64_t						_since;		//? last decode (ticks)
+# endif
+
+		//? stream key (see KeyWord)
+		inline uint64_t key(void) const
+		{
+			return (Kw::expand(_key));
+		}
+
+		inline const CharT* chars(void) const
+		{
+			return (reinterpret_cast<const CharT*>(const_cast<const char*>(_data)));
+		}
+
+		//? ========================================================
+		//? xor pass shared by unlock() and lock()
+		//? ========================================================
+		inline void xorPass(void)
+		{
+			xorPass(HeavyTag<isHeavy>());
+			for (size_t i = N; i < N + W; ++i)
+				_data[i] = '\0';
+		}
+
+		//? HEAVY: one expression per character
+		inline void xorPass(HeavyTag<true>)
+		{
+			heavyPass(typename MakeIndex<N>::type(), HeavyTag<(Flags & HV_CACHED) != 0>());
+		}
+
+		template<int... Index>
+		inline void heavyPass(IndexList<Index...>, HeavyTag<false>)
+		{
+			int dummy[] = { (_data[Index] = _data[Index] ^ (((Index & 3) == ((key() >> 5) & 3)) ? C::at(key(), Index) : Ks::keyStream(key(), Index)), 0)..., 0 };
+			(void)dummy;
+		}
+
+		//? HV_CACHED: same per-character expansion, lanes from a
+		//? per-pass cache (one mix(k, 0), see Cipher::Cache)
+		template<int... Index>
+		inline void heavyPass(IndexList<Index...>, HeavyTag<true>)
+		{
+			const uint64_t			k = key();
+			const uint64_t			lane = (k >> 5) & 3;
+			const typename C::Cache	cache(k);
+			int						dummy[] = { (_data[Index] = char(_data[Index] ^ (((Index & 3) == lane) ? cache.at(k, Index) : Ks::keyStream(k, Index))), 0)..., 0 };
+
+			(void)dummy;
+		}
+
+		inline void xorPass(HeavyTag<false>)
+		{
+			Ks::xorWith(_data, key());
+		}
+
+		//? ========================================================
+		//? Encrypting constructors, one per backend
+		//? ========================================================
+		//? (void)s: unused for "" (empty pack)
+		template<int... Index>
+		SVXOR_FORCEINLINE constexpr ObfString(const Lit* s, uint64_t salt, IndexList<Index...> SVXOR_SITE_PARAM) : Ks(streamKey<Flags>(salt), IndexList<Index...>()), _state(ST_LOCKED), _key(Kw::store(salt)), _data{ char(litByte(s, Index) ^ C::at(streamKey<Flags>(salt), Index))..., ((void)s, '\0') } SVXOR_SITE_INIT {}
+
+# ifdef SVXOR_LOOP_BACKEND
+		//? volatile semantics don't apply during construction
+		SVXOR_FORCEINLINE constexpr ObfString(const Lit* s, uint64_t salt, Length<N> SVXOR_SITE_PARAM) : Ks(streamKey<Flags>(salt), Length<N>()), _state(ST_LOCKED), _key(Kw::store(salt)), _data{} SVXOR_SITE_INIT
+		{
+			for (size_t i = 0; i < N; ++i)
+				_data[i] = char(litByte(s, i) ^ C::at(streamKey<Flags>(salt), i));
+		}
+	public:
+		//? ========================================================
+		//? From an encode() result (OBFX stack objects)
+		//?
+		//? Runtime only: volatile semantics don't apply yet, the
+		//? ciphertext is a plain copy of the constant.
+		//? ========================================================
+		SVXOR_FORCEINLINE ObfString(const Encoded<N>& e, uint64_t salt SVXOR_SITE_PARAM_DEF) : Ks(streamKey<Flags>(salt), e), _state(ST_LOCKED), _key(Kw::store(salt)) SVXOR_SITE_INIT
+		{
+			std::memcpy(const_cast<char*>(_data), e.d, N);
+			std::memset(const_cast<char*>(_data) + N, 0, W);
+		}
+	private:
+# endif
+
+# ifdef SVXOR_INSTRUMENT
+		//? ========================================================
+		//? Site counters: pass ticks, unlocked time on relock / wipe
+		//? ========================================================
+		inline void statPass(uint32_t to, uint64_t t0)
+		{
+			const uint64_t	t1 = statTicks();
+
+			if (!_site)
+				return;
+			if (to == ST_UNLOCKED)
+			{
+				_site->record(STAT_DECODE, t1 - t0);
+				_since = t1;
+				return;
+			}
+			_site->record(STAT_RELOCK, t1 - t0);
+			_site->recordUnlocked(t1 - _since);
+		}
+
+		inline void statWipe(uint64_t t0, bool open)
+		{
+			if (!_site)
+				return;
+			_site->record(STAT_WIPE, statTicks() - t0);
+			if (open)
+				_site->recordUnlocked(t0 - _since);
+		}
+# endif
+
+		//? ========================================================
+		//? Phase transition from -> to, runs the xor pass once.
+		//? Waits while the object is BUSY or pinned by readers.
+		//? Returns with extra readers already pinned when asked.
+		//? ========================================================
+		inline void transition(uint32_t from, uint32_t to, uint32_t pinned = 0)
+		{
+			uint32_t	s = _state.load(std::memory_order_acquire);
+			unsigned	spins = 0;
+
+			for (;;)
+			{
+				if ((s & ST_PHASE) == to)
+				{
+					if (!pinned || _state.compare_exchange_weak(s, s + pinned, std::memory_order_acquire, std::memory_order_acquire))
+						return;
+					continue;
+				}
+				if ((s & ~ST_RELOCK) == from)
+				{
+					if (_state.compare_exchange_weak(s, ST_BUSY, std::memory_order_acquire, std::memory_order_acquire))
+					{
+						SVXOR_STAT(const uint64_t t0 = statTicks();)
+						xorPass();
+						SVXOR_STAT(statPass(to, t0);)
+						_state.store(to + pinned, std::memory_order_release);
+						return;
+					}
+					continue;
+				}
+				cpuRelax(spins);
+				s = _state.load(std::memory_order_acquire);
+			}
+		}
+
+		//? ========================================================
+		//? Pin the current phase (LOCKED or UNLOCKED) as a reader
+		//? ========================================================
+		inline uint32_t pin(void)
+		{
+			uint32_t	s = _state.load(std::memory_order_acquire);
+			unsigned	spins = 0;
+
+			for (;;)
+			{
+				if ((s & ST_PHASE) == ST_LOCKED || (s & ST_PHASE) == ST_UNLOCKED)
+				{
+					if (_state.compare_exchange_weak(s, s + ST_READER, std::memory_order_acquire, std::memory_order_acquire))
+						return (s & ST_PHASE);
+					continue;
+				}
+				cpuRelax(spins);
+				s = _state.load(std::memory_order_acquire);
+			}
+		}
+
+		inline void unpin(void)
+		{
+			if (_state.fetch_sub(ST_READER, std::memory_order_release) - ST_READER == (ST_UNLOCKED | ST_RELOCK))
+				this->relockFrom(ST_UNLOCKED | ST_RELOCK);
+		}
+
+		//? ========================================================
+		//? UNLOCKED -> LOCKED if the word is still s (no reader)
+		//? ========================================================
+		inline bool relockFrom(uint32_t s)
+		{
+			return (this->relockFrom(s, []() { return (true); }));
+		}
+
+		//? keep() runs once the word is BUSY: false restores s
+		//? without a pass
+		template<typename F>
+		inline bool relockFrom(uint32_t s, F keep)
+		{
+			const uint32_t	from = s;
+
+			if (!_state.compare_exchange_strong(s, ST_BUSY, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return (false);
+			if (!keep())
+			{
+				_state.store(from, std::memory_order_release);
+				return (false);
+			}
+			SVXOR_STAT(const uint64_t t0 = statTicks();)
+			xorPass();
+			SVXOR_STAT(statPass(ST_LOCKED, t0);)
+			_state.store(ST_LOCKED, std::memory_order_release);
+			return (true);
+		}
+
+		//? ========================================================
+		//? equals() backend
+		//? ========================================================
+		static inline size_t inputLength(const CharT* s)
+		{
+			return (svxor::inputLength(s, N / W));
+		}
+
+		//? first n bytes against in, see diffBytes
+		inline uint64_t diff(const CharT* s, size_t n, bool ct)
+		{
+			const char*		in = reinterpret_cast<const char*>(s);
+			const uint32_t	phase = pin();
+			uint64_t		d;
+
+			if (phase == ST_LOCKED)
+				d = Ks::diffWith(_data, in, key(), n, ct);
+			else
+				d = svxor::diffBytes(_data, in, n, ct);
+			unpin();
+			return (d);
+		}
+
+		inline bool compare(const CharT* s, size_t len, bool ct)
+		{
+			if (!s || len != N / W)
+				return (false);
+			return (this->diff(s, N, ct) == 0);
+		}
+
+		//? NUL-terminated s, one pass (see diffStr)
+		inline bool compare(const CharT* s, bool ct)
+		{
+			if (!s)
+				return (false);
+
+			const uint32_t	phase = pin();
+			uint64_t		d;
+
+			if (phase == ST_LOCKED)
+			{
+				const Ks&		ks = *this;
+				const uint64_t	k = key();
+
+				d = svxor::diffStr(_data, s, N, [&ks, k](char* b, size_t pos, size_t m) { ks.xorAt(b, b, k, pos, m); }, ct);
+			}
+			else
+				d = svxor::diffStr(_data, s, N, [](char*, size_t, size_t) {}, ct);
+			unpin();
+			return (d == 0);
+		}
+
+		//? ========================================================
+		//? Plaintext bytes [pos, pos + n) into out, from the
+		//? ciphertext (locked) or the buffer (unlocked)
+		//? ========================================================
+		inline void readBytes(char* out, size_t pos, size_t n)
+		{
+			const uint32_t	phase = pin();
+
+			if (phase == ST_LOCKED)
+				Ks::xorAt(out, _data + pos, key(), pos, n);
+			else
+				std::memcpy(out, const_cast<const char*>(_data) + pos, n);
+			unpin();
+		}
+
+		//? ========================================================
+		//? View exit (pinned, so UNLOCKED): relocks when it is the
+		//? last reader (one CAS), otherwise unpins and leaves the
+		//? relock to the last unpin() (ST_RELOCK)
+		//? ========================================================
+		inline void unpinLock(void)
+		{
+			uint32_t	s = _state.load(std::memory_order_relaxed);
+
+			for (;;)
+			{
+				if ((s & ~ST_RELOCK) == ST_UNLOCKED + ST_READER)
+				{
+					if (this->relockFrom(s))
+						return;
+				}
+				else if (_state.compare_exchange_weak(s, (s - ST_READER) | ST_RELOCK, std::memory_order_release, std::memory_order_relaxed))
+					return;
+				s = _state.load(std::memory_order_relaxed);
+			}
+		}
+
+		//? ========================================================
+		//? Buffer of o in its current phase (pinned while copied),
+		//? key / keystream already copied by the caller
+		//? ========================================================
+		inline void copyFrom(ObfString& o)
+		{
+			const uint32_t phase = o.pin();
+
+			std::memcpy(const_cast<char*>(_data), const_cast<const char*>(o._data), N + W);
+			_state.store(phase, std::memory_order_release);
+			o.unpin();
+		}
+
+		//? ========================================================
+		//? Moved-from state: buffer, key and keystream zeroed,
+		//? unlocked. Reads as an empty string, lock() / unlock()
+		//? round-trip the zeros, nothing of the source is left.
+		//? ========================================================
+		inline void release(void)
+		{
+			_key = 0;
+			svxor::secureWipe(_data, N + W);
+			Ks::wipeKeyStream();
+			SVXOR_STAT(_site = nullptr;)
+			_state.store(ST_UNLOCKED, std::memory_order_release);
+		}
+	public:
+		//? ========================================================
+		//? Scoped reader
+		//?
+		//? Keeps the string unlocked for its lifetime: lock() waits
+		//? until the last reader is gone. Readers don't block each
+		//? other.
+		//? ========================================================
+		class Reader
+		{
+		private:
+			ObfString*	_obj;
+
+			Reader& operator=(const Reader&);
+		public:
+			inline explicit Reader(ObfString* obj) : _obj(obj) {}
+			inline Reader(Reader&& o) : _obj(o._obj) { o._obj = nullptr; }
+
+			inline const CharT* c_str(void) const
+			{
+				return (_obj->chars());
+			}
+
+			~Reader(void)
+			{
+				if (_obj)
+					_obj->unpin();
+			}
+		};
+
+		//? ========================================================
+		//? Scoped view (see view())
+		//?
+		//? A Reader that relocks on scope exit: the last View out
+		//? re-xors the string, or, when other readers are still
+		//? pinned (Reader, decode_to(), equals()...), marks it for
+		//? the last of them to relock.
+		//? ========================================================
+		class View
+		{
+		private:
+			ObfString*	_obj;
+
+			View& operator=(const View&);
+		public:
+			inline explicit View(ObfString* obj) : _obj(obj) {}
+			inline View(View&& o) : _obj(o._obj) { o._obj = nullptr; }
+
+			inline const CharT* c_str(void) const
+			{
+				return (_obj->chars());
+			}
+
+			inline const CharT* data(void) const
+			{
+				return (_obj->chars());
+			}
+
+			static inline constexpr size_t size(void)
+			{
+				return (N / W);
+			}
+# ifdef SVXOR_HAS_STRING_VIEW
+
+			inline std::basic_string_view<CharT> get(void) const
+			{
+				return (std::basic_string_view<CharT>(_obj->chars(), N / W));
+			}
+
+			inline operator std::basic_string_view<CharT>(void) const
+			{
+				return (this->get());
+			}
+# endif
+
+			~View(void)
+			{
+				if (_obj)
+					_obj->unpinLock();
+			}
+		};
+
+		//? ========================================================
+		//? Compile-time constructor
+		//?
+		//? - xor the string literal at compile-time
+		//? - Derives a unique key using BUILD_KEY + salt
+		//? ========================================================
+		SVXOR_FORCEINLINE constexpr ObfString(const Lit* s, uint64_t salt SVXOR_SITE_PARAM_DEF) : ObfString(s, salt, L() SVXOR_SITE_ARG) {}
+
+		//? ========================================================
+		//? Copy constructor
+		//?
+		//? Snapshot of the source in its current phase.
+		//? ========================================================
+		inline ObfString(const ObfString& o) : Ks(o), _state(ST_LOCKED), _key(o._key) SVXOR_STAT(, _site(o._site), _since(o._since))
+		{
+			this->copyFrom(const_cast<ObfString&>(o));
+		}
+
+		//? ========================================================
+		//? Move constructor
+		//?
+		//? The bytes live in the object: a move is the copy, then
+		//? the source is wiped (see release()) so no plaintext or
+		//? keystream is left behind. No xor pass, never throws:
+		//? containers move instead of copying on reallocation.
+		//? ========================================================
+		inline ObfString(ObfString&& o) noexcept : Ks(o), _state(ST_LOCKED), _key(o._key) SVXOR_STAT(, _site(o._site), _since(o._since))
+		{
+			this->copyFrom(o);
+			o.release();
+		}
+
+		//? ========================================================
+		//? Assignment, same as the constructors. The target must
+		//? not be in use (no reader, no other thread).
+		//? ========================================================
+		inline ObfString& operator=(const ObfString& o)
+		{
+			if (this != &o)
+			{
+				Ks::operator=(o);
+				_key = o._key;
+				SVXOR_STAT(_site = o._site; _since = o._since;)
+				this->copyFrom(const_cast<ObfString&>(o));
+			}
+			return (*this);
+		}
+
+		inline ObfString& operator=(ObfString&& o) noexcept
+		{
+			if (this != &o)
+			{
+				*this = static_cast<const ObfString&>(o);
+				o.release();
+			}
+			return (*this);
+		}
+
+		//? ========================================================
+		//? unlock the string (unxor)
+		//?
+		//? Safe to call multiple times, cancels a pending View
+		//? relock.
+		//? ========================================================
+		inline volatile CharT* unlock(void)
+		{
+			//? seq_cst: ordered after a TTL touch() (svxor_ttl.hpp)
+			const uint32_t s = _state.load(std::memory_order_seq_cst);
+
+			if ((s & ST_PHASE) != ST_UNLOCKED)
+				transition(ST_LOCKED, ST_UNLOCKED);
+			else if (s & ST_RELOCK)
+				_state.fetch_and(~uint32_t(ST_RELOCK), std::memory_order_relaxed);
+			return (reinterpret_cast<volatile CharT*>(_data));
+		}
+
+		//? ========================================================
+		//? Explicitly re-xor the string
+		//?
+		//? Safe to call multiple times.
+		//? Waits for pinned readers to be done.
+		//? ========================================================
+		inline volatile CharT* lock(void)
+		{
+			if (_state.load(std::memory_order_acquire) != ST_LOCKED)
+				transition(ST_UNLOCKED, ST_LOCKED);
+			return (reinterpret_cast<volatile CharT*>(_data));
+		}
+
+		//? ========================================================
+		//? lock() without waiting
+		//?
+		//? Re-xor only when unlocked and not pinned by a reader.
+		//? Returns true when the string is locked afterwards.
+		//? ========================================================
+		inline bool try_lock(void)
+		{
+			if (this->relockFrom(ST_UNLOCKED) || this->relockFrom(ST_UNLOCKED | ST_RELOCK))
+				return (true);
+			return (_state.load(std::memory_order_acquire) == ST_LOCKED);
+		}
+
+		//? ========================================================
+		//? try_lock() that backs out when idle() turns false
+		//?
+		//? idle() runs after the state CAS won (c_str() callers
+		//? now wait), before the pass: the TTL sweeper re-checks
+		//? the last access there.
+		//? ========================================================
+		template<typename F>
+		inline bool try_lock_if(F idle)
+		{
+			if (this->relockFrom(ST_UNLOCKED, idle) || this->relockFrom(ST_UNLOCKED | ST_RELOCK, idle))
+				return (true);
+			return (_state.load(std::memory_order_acquire) == ST_LOCKED);
+		}
+
+		//? ========================================================
+		//? unlock the string and pin it until the Reader is gone
+		//? ========================================================
+		inline Reader read(void)
+		{
+			transition(ST_LOCKED, ST_UNLOCKED, ST_READER);
+			return (Reader(this));
+		}
+
+		//? ========================================================
+		//? unlock the string until the View is gone, then relock
+		//?
+		//?   { auto v = obj.view(); use(v.get()); } // string_view
+		//?
+		//? Like lock(), the relock turns c_str() pointers taken
+		//? elsewhere into garbage: use read() to leave it decoded.
+		//? ========================================================
+		inline View view(void)
+		{
+			transition(ST_LOCKED, ST_UNLOCKED, ST_READER);
+			return (View(this));
+		}
+
+		//? ========================================================
+		//? Length of the string in characters (without terminator)
+		//? ========================================================
+		static inline constexpr size_t size(void)
+		{
+			return (N / W);
+		}
+
+		//? ========================================================
+		//? Decode into a caller buffer (zero-copy read path)
+		//?
+		//? Writes up to cap - 1 characters + '\0' to dst in one
+		//? pass and returns the number of characters written.
+		//? The object is left untouched (still locked, or still
+		//? unlocked), readers don't block each other.
+		//? ========================================================
+		inline size_t decode_to(CharT* dst, size_t cap)
+		{
+			if (!cap)
+				return (0);
+
+			const size_t	n = (cap - 1 < N / W) ? (cap - 1) : N / W;
+
+			this->readBytes(reinterpret_cast<char*>(dst), 0, n * W);
+			dst[n] = CharT(0);
+			return (n);
+		}
+
+		//? ========================================================
+		//? Decoded copy as a std::basic_string<CharT>
+		//?
+		//? One allocation of size() characters (none within SSO),
+		//? decoded straight into it like decode_to(): no unlock,
+		//? no strlen, no relock. The string is not wiped when it
+		//? dies, prefer view() / decode_to() for secrets.
+		//? ========================================================
+		inline std::basic_string<CharT> to_string(void)
+		{
+			std::basic_string<CharT>	s;
+
+# if defined(__cpp_lib_string_resize_and_overwrite) && (__cpp_lib_string_resize_and_overwrite >= 202110L)
+			s.resize_and_overwrite(N / W, [this](CharT* p, size_t) { this->readBytes(reinterpret_cast<char*>(p), 0, N); return (size_t(N / W)); });
+# else
+			s.resize(N / W);
+			this->readBytes(reinterpret_cast<char*>(&s[0]), 0, N);
+# endif
+			return (s);
+		}
+
+		//? ========================================================
+		//? Random access
+		//?
+		//? Only the requested characters are decoded (word-wide,
+		//? keystream taken at their offset), the object stays as it
+		//? is: cost scales with the range, not with size().
+		//? decode_range() writes min(len, size() - pos) characters,
+		//? no terminator, and returns that count.
+		//? at() returns '\0' past the end.
+		//? ========================================================
+		inline size_t decode_range(size_t pos, size_t len, CharT* dst)
+		{
+			if (pos >= N / W)
+				return (0);
+			if (len > N / W - pos)
+				len = N / W - pos;
+			this->readBytes(reinterpret_cast<char*>(dst), pos * W, len * W);
+			return (len);
+		}
+
+		inline CharT at(size_t i)
+		{
+			CharT	c = CharT(0);
+
+			if (i < N / W)
+				this->readBytes(reinterpret_cast<char*>(&c), i * W, W);
+			return (c);
+		}
+
+		//? ========================================================
+		//? Prefix test without decoding (see equals): the first
+		//? len characters are compared, the rest is never touched.
+		//? Without len, s is scanned up to size() + 1 chars.
+		//? ========================================================
+		inline bool starts_with(const CharT* s, size_t len)
+		{
+			if (!s || len > N / W)
+				return (false);
+			return (this->diff(s, len * W, false) == 0);
+		}
+
+		inline bool starts_with(const CharT* s)
+		{
+			return (this->starts_with(s, inputLength(s)));
+		}
+
+		//? ========================================================
+		//? Streaming decode
+		//?
+		//? Calls fn(const CharT* chunk, size_t len) over the string
+		//? with at most SVXOR_CHUNK bytes of plaintext at a time,
+		//? on a stack buffer that is cleared afterwards.
+		//? fn must not lock()/unlock() this object.
+		//? ========================================================
+		template<typename F>
+		inline void decode_chunks(F fn)
+		{
+			static_assert(SVXOR_CHUNK % W == 0, "svxor: SVXOR_CHUNK is not a multiple of the character size");
+
+			alignas(CharT) char	buf[SVXOR_CHUNK];
+			const uint32_t		phase = pin();
+
+			for (size_t pos = 0; pos < N; pos += SVXOR_CHUNK)
+			{
+				const size_t n = ((N - pos) < SVXOR_CHUNK) ? (N - pos) : SVXOR_CHUNK;
+
+				if (phase == ST_LOCKED)
+					Ks::xorAt(buf, _data + pos, key(), pos, n);
+				else
+					std::memcpy(buf, const_cast<const char*>(_data) + pos, n);
+				fn(reinterpret_cast<const CharT*>(buf), n / W);
+			}
+			unpin();
+			svxor::secureWipe(buf, sizeof(buf));
+		}
+
+		//? ========================================================
+		//? Compare without decoding
+		//?
+		//? The input is encrypted with the object keystream and
+		//? compared to the ciphertext, the literal never exists
+		//? in clear. A length mismatch returns early.
+		//? equals_ct() doesn't stop at the first difference:
+		//? for the same length, timing doesn't depend on content.
+		//? Without len, s is scanned up to size() + 1 chars.
+		//? ========================================================
+		inline bool equals(const CharT* s, size_t len)
+		{
+			return (this->compare(s, len, false));
+		}
+
+		inline bool equals(const CharT* s)
+		{
+			return (this->compare(s, false));
+		}
+
+		inline bool equals_ct(const CharT* s, size_t len)
+		{
+			return (this->compare(s, len, true));
+		}
+
+		inline bool equals_ct(const CharT* s)
+		{
+			return (this->compare(s, true));
+		}
+
+		//? ========================================================
+		//? alias for unxor()
+		//? ========================================================
+		inline const CharT* c_str(void)
+		{
+			this->unlock();
+			return (this->chars());
+		}
+
+		inline const CharT* c_data(void)
+		{
+			return (this->chars());
+		}
+
+		//? ========================================================
+		//? Destructor
+		//?
+		//? Clears buffer and key to reduce memory residue,
+		//? see WIPE_FULL / WIPE_PLAIN / WIPE_NONE.
+		// ========================================================
+		~ObfString(void)
+		{
+			SVXOR_STAT(const uint64_t t0 = statTicks();)
+			SVXOR_STAT(const bool open = (_state.load(std::memory_order_relaxed) & ST_PHASE) == ST_UNLOCKED;)
+			wipe();
+			SVXOR_STAT(statWipe(t0, open);)
+		}
+	private:
+		inline void wipe(void)
+		{
+			if (Flags & WIPE_NONE)
+				return;
+			if (Flags & WIPE_PLAIN)
+			{
+				if ((_state.load(std::memory_order_acquire) & ST_PHASE) != ST_LOCKED)
+					svxor::secureWipe(_data, N + W);
+				return;
+			}
+			_key = 0;
+			svxor::secureWipe(_data, N + W);
+			Ks::wipeKeyStream();
+		}
+	};
+	//? ============================================================
+	//? Comparison literal (see OBF_EQ)
+	//?
+	//? Constant ciphertext + KS_REGEN key, no state word: the
+	//? input is encrypted with the keystream and compared to the
+	//? ciphertext (the KS_REGEN ObfString compare kernel), one
+	//? pass, nothing pinned or written, no shared cache line
+	//? between threads comparing at the same call site.
+	//? ============================================================
+	template<size_t N>
+	struct EqLiteral
+	{
+		Encoded<N>	e;
+		uint64_t	k;
+
+		inline bool compare(const char* s, size_t len, bool ct) const
+		{
+			const char* enc = e.d;
+
+			if (!s || len != N)
+				return (false);
+			//? a constant object: hide it, or the xor is folded
+			SVXOR_OPAQUE(enc);
+			return (Cipher<false>::diff(enc, s, k, N, ct) == 0);
+		}
+
+		//? NUL-terminated s, one pass (see diffStr)
+		inline bool compare(const char* s, bool ct) const
+		{
+			const char*		enc = e.d;
+			const uint64_t	key = k;
+
+			if (!s)
+				return (false);
+			SVXOR_OPAQUE(enc);
+			return (svxor::diffStr(enc, s, N, [key](char* b, size_t pos, size_t m) { Cipher<false>::xorAt(b, b, key, m, pos); }, ct) == 0);
+		}
+
+		inline bool equals(const char* s, size_t len) const
+		{
+			return (this->compare(s, len, false));
+		}
+
+		inline bool equals(const char* s) const
+		{
+			return (this->compare(s, false));
+		}
+
+		inline bool equals_ct(const char* s, size_t len) const
+		{
+			return (this->compare(s, len, true));
+		}
+
+		inline bool equals_ct(const char* s) const
+		{
+			return (this->compare(s, true));
+		}
+	};
+
+	//? ============================================================
+	//? OBF_SWITCH state
+	//?
+	//? Holds the input and its hash for the case labels. A failed
+	//? OBF_CASE_V verification calls reject(): the switch is run
+	//? once more with hash 0, which only matches default.
+	//? ============================================================
+	class StrSwitch
+	{
+	private:
+		const char*	_s;
+		size_t		_n;
+		uint64_t	_h;
+		bool		_first;
+		bool		_retry;
+	public:
+		inline StrSwitch(uint64_t seed, const char* s) : _s(s), _n(s ? std::strlen(s) : 0), _h(s ? hashBytes(seed, s, _n) : 0), _first(true), _retry(false) {}
+		inline StrSwitch(uint64_t seed, const char* s, size_t n) : _s(s), _n(n), _h(s ? hashBytes(seed, s, n) : 0), _first(true), _retry(false) {}
+
+		inline bool next(void)
+		{
+			const bool	run = _first || _retry;
+
+			_first = false;
+			_retry = false;
+			return (run);
+		}
+
+		inline void reject(void)
+		{
+			_h = 0;
+			_retry = true;
+		}
+
+		inline uint64_t hash(void) const
+		{
+			return (_h);
+		}
+
+		inline const char* str(void) const
+		{
+			return (_s);
+		}
+
+		inline size_t size(void) const
+		{
+			return (_n);
+		}
+	};
+
+	//? ============================================================
+	//? Obfuscated integral constant (see OBF_INT)
+	//?
+	//? The binary holds v ^ mask as an immediate, mask being
+	//? mix64 of the call site salt truncated to the type. get()
+	//? hides the immediate from the optimizer and xors it back:
+	//? two instructions, in registers, nothing to wipe.
+	//? ============================================================
+	template<typename T>
+	struct IntBits
+	{
+		static_assert((std::is_integral<T>::value || std::is_enum<T>::value) && !std::is_same<T, bool>::value, "svxor: OBF_INT / OBF_ARRAY need an integral or enum type");
+		typedef typename std::make_unsigned<T>::type type;
+	};
+
+	template<typename T>
+	struct ObfInt
+	{
+		typedef typename IntBits<T>::type U;
+
+		U	c;
+
+		SVXOR_FORCEINLINE T get(uint64_t k) const
+		{
+			U x = c;
+
+			SVXOR_OPAQUE(x);
+			return (T(U(x ^ U(mix64(k)))));
+		}
+	};
+
+	//? compile-time side, T deduced from the (decayed) value
+	template<typename T>
+	inline constexpr ObfInt<T> intEncode(T v, uint64_t k)
+	{
+		return (ObfInt<T>{ typename IntBits<T>::type(typename IntBits<T>::type(v) ^ typename IntBits<T>::type(mix64(k))) });
+	}
+
+	//? ============================================================
+	//? Obfuscated constant table (see OBF_ARRAY)
+	//?
+	//? Element i is xored with its bytes of the counter-mode
+	//? keystream (KS_CTR, same layout as a blob of the array):
+	//? operator[] decodes that element only, one mix64 per access,
+	//? the table itself is never written.
+	//? ============================================================
+	template<typename U>
+	inline constexpr U arrayMask(uint64_t k, size_t i)
+	{
+		return (U(ctrWord(k, (i * sizeof(U)) >> 3) >> (((i * sizeof(U)) & 7) * 8)));
+	}
+
+	template<typename T, size_t N>
+	class ObfArray
+	{
+	private:
+		typedef typename IntBits<T>::type U;
+
+		U			_data[N];
+		uint64_t	_key;
+
+# ifndef SVXOR_LOOP_BACKEND
+		template<int... Index>
+		constexpr ObfArray(const T (&v)[N], uint64_t k, IndexList<Index...>)
+			: _data{ U(U(v[Index]) ^ arrayMask<U>(k, Index))... }, _key(k) {}
+# endif
+	public:
+# ifdef SVXOR_LOOP_BACKEND
+		constexpr ObfArray(const T (&v)[N], uint64_t k) : _data{}, _key(k)
+		{
+			for (size_t i = 0; i < N; ++i)
+				_data[i] = U(U(v[i]) ^ arrayMask<U>(k, i));
+		}
+# else
+		constexpr ObfArray(const T (&v)[N], uint64_t k) : ObfArray(v, k, typename MakeIndex<int(N)>::type()) {}
+# endif
+
+		static inline constexpr size_t size(void)
+		{
+			return (N);
+		}
+
+		//? no bounds check, like a plain array
+		inline T operator[](size_t i) const
+		{
+			const U* p = _data;
+
+			SVXOR_OPAQUE(p);
+			return (T(U(p[i] ^ arrayMask<U>(_key, i))));
+		}
+
+		//? ========================================================
+		//? Decodes min(N, cap) elements into dst, returns the count
+		//? ========================================================
+		inline size_t decode_to(T* dst, size_t cap) const
+		{
+			const size_t n = (cap < N) ? cap : N;
+
+			for (size_t i = 0; i < n; ++i)
+				dst[i] = (*this)[i];
+			return (n);
+		}
+	};
+
+	//? type only (OBF_ARRAY), never defined
+	template<typename T, size_t N>
+	ObfArray<T, N> arrayOf(const T (&v)[N]);
+
+	//? ============================================================
+	//? Object size report (static_assert friendly, see
+	//? OBF_LAYOUT_ASSERT)
+	//?
+	//? lines:    cache lines touched when the object starts a line
+	//? maxLines: worst case over the placements its alignment
+	//?           allows
+	//? ============================================================
+	template<typename T>
+	struct Layout
+	{
+		static constexpr size_t bytes = sizeof(T);
+		static constexpr size_t align = alignof(T);
+		static constexpr size_t lines = (sizeof(T) + SVXOR_CACHE_LINE - 1) / SVXOR_CACHE_LINE;
+		static constexpr size_t maxLines = (align >= SVXOR_CACHE_LINE) ? lines : (SVXOR_CACHE_LINE - align + sizeof(T) + SVXOR_CACHE_LINE - 1) / SVXOR_CACHE_LINE;
+	};
+
+# ifndef SVXOR_INSTRUMENT
+	//? instrumented objects carry a site pointer and a timestamp
+	static_assert(sizeof(ObfString<IndexList<>, false, KS_REGEN | LAYOUT_PACKED>) <= 12, "svxor: packed header is not 8 bytes");
+	static_assert(Layout<ObfString<IndexList<>, false, KS_REGEN | ALIGN_LINE>>::bytes == SVXOR_CACHE_LINE, "svxor: ALIGN_LINE object is not one cache line");
+# endif
+
+# ifdef SVXOR_HAS_REGISTRY
+	//? ============================================================
+	//? Static object registry
+	//?
+	//? OBF_ST / OBF_STC / OBF_STT objects, OBF_TABLE tables and
+	//? svxor_gen catalogs register a constant-initialized
+	//? descriptor in the svxor_reg section(s): no constructor, no
+	//? list to maintain (ObfHolder: see RegNode). The linker lays the
+	//? descriptors out as one array, bulk operations are a single
+	//? linear walk. Each executable / shared object sees its own
+	//? section.
+	//? A table or catalog is one descriptor: unlock() decodes
+	//? every entry, size() is their total length.
+	//? ============================================================
+	struct RegEntry
+	{
+		void*			obj;
+		size_t			len;
+		const char*		(*unlockFn)(void*);
+		void			(*lockFn)(void*);
+
+		inline size_t size(void) const
+		{
+			return (len);
+		}
+
+		inline const char* unlock(void) const
+		{
+			return (unlockFn(obj));
+		}
+
+		inline void lock(void) const
+		{
+			lockFn(obj);
+		}
+	};
+
+	template<typename T>
+	struct RegOps
+	{
+		static const char* unlock(void* p)
+		{
+			return (static_cast<T*>(p)->c_str());
+		}
+
+		static void lock(void* p)
+		{
+			static_cast<T*>(p)->lock();
+		}
+	};
+
+	template<typename T>
+	inline constexpr RegEntry regEntry(T& obj, size_t len)
+	{
+		return (RegEntry{ &obj, len, &RegOps<T>::unlock, &RegOps<T>::lock });
+	}
+
+	template<typename T>
+	inline constexpr RegEntry regEntry(T& obj)
+	{
+		return (regEntry(obj, T::size()));
+	}
+
+	//? section bounds, null when nothing registered
+	extern const RegEntry regStart[] __asm__("__start_svxor_reg") __attribute__((weak, visibility("hidden")));
+	extern const RegEntry regStop[] __asm__("__stop_svxor_reg") __attribute__((weak, visibility("hidden")));
+	extern const RegEntry regInlineStart[] __asm__("__start_svxor_reg_inline") __attribute__((weak, visibility("hidden")));
+	extern const RegEntry regInlineStop[] __asm__("__stop_svxor_reg_inline") __attribute__((weak, visibility("hidden")));
+
+	//? ============================================================
+	//? Walks [b, e), split across up to `threads` threads
+	//? (SVXOR_REG_GRAIN entries at least each)
+	//? ============================================================
+	template<typename F>
+	inline void regWalk(const RegEntry* b, const RegEntry* e, F& fn, unsigned threads)
+	{
+		const size_t	n = size_t(e - b);
+
+		if (threads > 1 && n >= 2 * size_t(SVXOR_REG_GRAIN))
+		{
+			const unsigned		left = threads / 2;
+			const RegEntry*		mid = b + n * left / threads;
+			std::thread			t([mid, e, &fn, threads, left]() { regWalk(mid, e, fn, threads - left); });
+
+			regWalk(b, mid, fn, left);
+			t.join();
+			return;
+		}
+		for (; b != e; ++b)
+			fn(*b);
+	}
+
+	//? ============================================================
+	//? Runtime registrations (ObfHolder)
+	//?
+	//? GCC before 14 drops the section attribute of statics in
+	//? templates: those objects link a node on first use instead
+	//? (one CAS, ever), walked after the sections.
+	//? ============================================================
+	struct RegNode
+	{
+		RegEntry	e;
+		RegNode*	next;
+	};
+
+	inline std::atomic<RegNode*>& regList(void)
+	{
+		static std::atomic<RegNode*>	h(nullptr);
+
+		return (h);
+	}
+
+	inline bool regLink(RegNode& n)
+	{
+		RegNode* h = regList().load(std::memory_order_relaxed);
+
+		do
+			n.next = h;
+		while (!regList().compare_exchange_weak(h, &n, std::memory_order_release, std::memory_order_relaxed));
+		return (true);
+	}
+
+	//? ============================================================
+	//? Number of registered objects
+	//? ============================================================
+	inline size_t registry_size(void)
+	{
+		size_t	n = size_t(regStop - regStart) + size_t(regInlineStop - regInlineStart);
+
+		for (const RegNode* p = regList().load(std::memory_order_acquire); p; p = p->next)
+			++n;
+		return (n);
+	}
+
+	//? ============================================================
+	//? Calls fn(const RegEntry&) for every registered object
+	//?
+	//? With threads > 1, fn runs concurrently on disjoint slices.
+	//? ============================================================
+	template<typename F>
+	inline void for_each(F fn, unsigned threads = 1)
+	{
+		regWalk(regStart, regStop, fn, threads);
+		regWalk(regInlineStart, regInlineStop, fn, threads);
+		for (const RegNode* p = regList().load(std::memory_order_acquire); p; p = p->next)
+			fn(p->e);
+	}
+
+	//? ============================================================
+	//? Bulk unlock (startup pre-decode) / lock (shutdown re-xor)
+	//? ============================================================
+	inline void unlock_all(unsigned threads = 1)
+	{
+		svxor::for_each([](const RegEntry& e) { e.unlock(); }, threads);
+	}
+
+	inline void lock_all(unsigned threads = 1)
+	{
+		svxor::for_each([](const RegEntry& e) { e.lock(); }, threads);
+	}
+# endif
+
+	template <typename T, bool heavy, uint32_t Flags = KS_STORED>
+	struct ObfHolder
+	{
+		static svxor::ObfString<T, heavy, Flags>& get(const char* s, uint64_t key)
+		{
+			static svxor::ObfString<T, heavy, Flags> obj(s, key);
+# ifdef SVXOR_HAS_REGISTRY
+			static RegNode node = { regEntry(obj), nullptr };
+			static const bool linked = regLink(node);
+
+			(void)linked;
+# endif
+			return (obj);
+		}
+	};
+}
+
+//! ============================================================
+//! MACROS
+//! ============================================================
+
+//? ============================================================
+//? Object type and per call site key
+//? ============================================================
+# ifdef SVXOR_LOOP_BACKEND
+#  define OBF_TYPE_T(s, heavy, flags, T) svxor::ObfString<svxor::Length<int(sizeof(s) - sizeof((s)[0]))>, heavy, flags, T>
+# else
+#  define OBF_TYPE_T(s, heavy, flags, T) svxor::ObfString<svxor::MakeIndex<sizeof(s) - sizeof((s)[0])>::type, heavy, flags, T>
+# endif
+# define OBF_TYPE(s, heavy, flags) OBF_TYPE_T(s, heavy, flags, char)
+# ifdef SVXOR_LOOP_BACKEND
+#  define OBF_ENCODE(s, flags, k) svxor::encode<(flags)>(s, k)
+# else
+#  define OBF_ENCODE(s, flags, k) svxor::encode<(flags)>(s, k, svxor::MakeIndex<sizeof(s) - sizeof((s)[0])>::type())
+# endif
+# define OBF_SALT() (svxor::BUILD_KEY ^ (uint64_t(__COUNTER__) * 0x9E3779B97F4A7C15ULL))
+
+//? ============================================================
+//? Call site counters (SVXOR_INSTRUMENT): SVXOR_SITE declares
+//? the Site of salt k, SVXOR_SITE_REF passes it to the ctor
+//? ============================================================
+# ifdef SVXOR_INSTRUMENT
+#  define SVXOR_SITE(name, k) static SVXOR_CONSTINIT svxor::Site name(__FILE__, __LINE__, k);
+#  define SVXOR_SITE_REF(name) , &name
+# else
+#  define SVXOR_SITE(name, k)
+#  define SVXOR_SITE_REF(name)
+# endif
+
+//? ============================================================
+//? Compile-time size check
+//?
+//?   OBF_LAYOUT_ASSERT("hot string", false, svxor::KS_REGEN, 1);
+//?
+//? Fails the build when the object may span more than limit
+//? cache lines.
+//? ============================================================
+# define OBF_LAYOUT_ASSERT(s, heavy, flags, limit) static_assert(svxor::Layout<OBF_TYPE(s, heavy, flags)>::maxLines <= (limit), "svxor: " #s " spans more cache lines than expected")
+
+//? ============================================================
+//? RAII object (stack-based, safe lifetime)
+//? ============================================================
+# ifdef SVXOR_LOOP_BACKEND
+#  define OBFX_T(s, heavy, flags, T) ([]() { constexpr uint64_t k = OBF_SALT(); static constexpr auto e = svxor::encode<(flags)>(s, k); SVXOR_SITE(site, k) return (OBF_TYPE_T(s, heavy, flags, T)(e, k SVXOR_SITE_REF(site))); }())
+# elif defined(SVXOR_INSTRUMENT)
+#  define OBFX_T(s, heavy, flags, T) ([]() { constexpr uint64_t k = OBF_SALT(); SVXOR_SITE(site, k) return (OBF_TYPE_T(s, heavy, flags, T)(s, k SVXOR_SITE_REF(site))); }())
+# else
+#  define OBFX_T(s, heavy, flags, T) (OBF_TYPE_T(s, heavy, flags, T)(s, OBF_SALT()))
+# endif
+# define OBFX(s, heavy, flags) OBFX_T(s, heavy, flags, char)
+# define OBF(s, heavy) OBFX(s, heavy, svxor::KS_STORED)
+# define OBF_H(s) OBF(s, true)
+# define OBF_L(s) OBF(s, false)
+
+//? ============================================================
+//? Wide, UTF-16, UTF-32 and raw byte literals
+//?
+//?   auto p = OBF_W(L"C:\\Windows", false);    c_str(): const wchar_t*
+//?   auto k = OBF_BYTES("\x13\x37\x00\x42", true);   const unsigned char*, size() 4
+//?
+//? Same object, keyed and xored per byte over the native
+//? representation: c_str() is the platform string, no
+//? conversion. OBFX_T(s, heavy, flags, T) for other flags.
+//? ============================================================
+# define OBF_W(s, heavy) OBFX_T(s, heavy, svxor::KS_STORED, wchar_t)
+# define OBF_U16(s, heavy) OBFX_T(s, heavy, svxor::KS_STORED, char16_t)
+# define OBF_U32(s, heavy) OBFX_T(s, heavy, svxor::KS_STORED, char32_t)
+# define OBF_BYTES(s, heavy) OBFX_T(s, heavy, svxor::KS_STORED, unsigned char)
+
+//? ============================================================
+//? Integral constants and tables
+//?
+//?   if (id == OBF_INT(0xf054)) ...          int, mov + xor
+//?   const auto& t = OBF_ARRAY(uint16_t, { 0x0001, 0x0002, 0xf054 });
+//?   t[i]                                    decodes t[i] only
+//?
+//? Keyed per call site like OBF. OBF_INT takes the type of its
+//? argument (0xf054u, uint64_t(x)...), integral or enum. The
+//? OBF_ARRAY object is a per call site constant (read-only, no
+//? destructor): the returned reference stays valid.
+//? ============================================================
+# define OBF_INT(v) ([]() { constexpr uint64_t k = OBF_SALT(); constexpr auto e = svxor::intEncode(v, k); return (e.get(k)); }())
+# define OBF_ARRAY(T, ...) ([]() -> const decltype(svxor::arrayOf<T>(__VA_ARGS__))& { static constexpr decltype(svxor::arrayOf<T>(__VA_ARGS__)) a(__VA_ARGS__, OBF_SALT()); return (a); }())
+
+//? ============================================================
+//? One-shot helper (INTENTIONALLY UB lifetime)
+//?
+//? Intended for immediate use only (printf, comparisons, etc).
+//? For printf / ostream see svxor_io.hpp (OBF_FMT).
+//? ============================================================
+# define OBF_ONCE(s, heavy) OBF(s, heavy).c_str()
+# define OBF_HONCE(s) OBF_ONCE(s, true)
+# define OBF_LONCE(s) OBF_ONCE(s, false)
+
+//# define __SNC__ 1
+# ifndef __SNC__
+//? ============================================================
+//? Static RAII object supported (non-SNC compiler)
+//?
+//? Function-local static, decoded on first c_str().
+//? OBF_ST / OBF_STC objects register in the svxor_reg section
+//? (SVXOR_REGISTER, see lock_all / unlock_all / for_each).
+//? ============================================================
+
+#  ifdef SVXOR_HAS_REGISTRY
+#   define SVXOR_REGISTER(obj) static SVXOR_CONSTINIT const svxor::RegEntry svxor_reg_##obj SVXOR_REG_SECTION = svxor::regEntry(obj);
+#  else
+#   define SVXOR_REGISTER(obj)
+#  endif
+
+#  define OBF_STX(fname, s, heavy, flags) static OBF_TYPE(s, heavy, flags)&	obf_##fname(void){static constexpr uint64_t k_##fname = OBF_SALT(); SVXOR_SITE(site_##fname, k_##fname) static OBF_TYPE(s, heavy, flags) s_##fname(s, k_##fname SVXOR_SITE_REF(site_##fname)); SVXOR_REGISTER(s_##fname) return (s_##fname);}
+#  define OBF_ST(fname, s, heavy) OBF_STX(fname, s, heavy, svxor::KS_STORED)
+#  define OBF_STL(fname, s) OBF_ST(fname, s, false)
+#  define OBF_STH(fname, s) OBF_ST(fname, s, true)
+
+//? ============================================================
+//? Constant-initialized static object (namespace scope)
+//?
+//? Same interface as OBF_ST, but the object is built by the
+//? constexpr constructor at compile-time and lives at namespace
+//? scope: obf_##fname() is a plain reference return, without
+//? the function-local static init guard (__cxa_guard_acquire).
+//? constinit enforces it when C++20 is available.
+//? ============================================================
+
+#  define OBF_STCX(fname, s, heavy, flags) static constexpr uint64_t k_##fname = OBF_SALT(); SVXOR_SITE(site_##fname, k_##fname) static SVXOR_CONSTINIT OBF_TYPE(s, heavy, flags) s_##fname(s, k_##fname SVXOR_SITE_REF(site_##fname)); SVXOR_REGISTER(s_##fname) static OBF_TYPE(s, heavy, flags)&	obf_##fname(void){return (s_##fname);}
+#  define OBF_STC(fname, s, heavy) OBF_STCX(fname, s, heavy, svxor::KS_STORED)
+#  define OBF_STCL(fname, s) OBF_STC(fname, s, false)
+#  define OBF_STCH(fname, s) OBF_STC(fname, s, true)
+
+# else
+//? ============================================================
+//? SNC compiler: no static RAII objects allowed
+//? Static char buffer decoded once (svxor::decodeOnce), the
+//? ciphertext is a constant. heavy only selects the xor pass
+//? of ObfString: both decode the same way here.
+//? ============================================================
+
+#  define OBF_STX(fname, s, heavy, flags) static const char*	obf_##fname(void) {static char s_##fname[sizeof(s)]; static std::atomic<uint32_t> once_##fname; static constexpr uint64_t k_##fname = OBF_SALT(); static constexpr svxor::Encoded<sizeof(s) - 1> e_##fname = OBF_ENCODE(s, flags, k_##fname); return (svxor::decodeOnce<(flags)>(once_##fname, s_##fname, e_##fname, k_##fname));}
+#  define OBF_ST(fname, s, heavy) OBF_STX(fname, s, heavy, svxor::KS_STORED)
+#  define OBF_STL(fname, s) OBF_ST(fname, s, false)
+#  define OBF_STH(fname, s) OBF_ST(fname, s, true)
+
+#  define OBF_STCX(fname, s, heavy, flags) OBF_STX(fname, s, heavy, flags)
+#  define OBF_STC(fname, s, heavy) OBF_ST(fname, s, heavy)
+#  define OBF_STCL(fname, s) OBF_STL(fname, s)
+#  define OBF_STCH(fname, s) OBF_STH(fname, s)
+# endif
+
+//? ============================================================
+//? Compare input against a literal without decoding it
+//?
+//? Per call site constant EqLiteral (KS_REGEN ciphertext + key,
+//? read-only), compared with equals(): one pass over the input,
+//? no object, no pin. Works on SNC (nothing to construct).
+//? OBF_EQ_CT: constant-time variant (equals_ct()).
+//? ============================================================
+# define OBF_EQX(s, fn, ...) ([]() -> const svxor::EqLiteral<sizeof(s) - 1>& { static constexpr uint64_t k = OBF_SALT(); static constexpr svxor::EqLiteral<sizeof(s) - 1> lit = { OBF_ENCODE(s, svxor::KS_REGEN, k), svxor::streamKey<svxor::KS_REGEN>(k) }; return (lit); }().fn(__VA_ARGS__))
+# define OBF_EQ(input, s) OBF_EQX(s, equals, input)
+# define OBF_EQ_CT(input, s) OBF_EQX(s, equals_ct, input)
+
+//? ============================================================
+//? Hashed string switch
+//?
+//?   OBF_SWITCH(input)            (or OBF_SWITCH(ptr, len))
+//?   {
+//?       OBF_CASE("foo")     ...; break;   // hash only
+//?       OBF_CASE_V("bar")   ...; break;   // hash + OBF_EQ check
+//?       default:            ...;
+//?   }
+//?
+//? One runtime hash of the input, the labels are salted
+//? compile-time hashes (no literal in the binary). OBF_CASE_V
+//? also compares against an encrypted copy and falls to default
+//? on a hash collision.
+//? The labels include the ':'. The switch sits in a one-shot
+//? for loop: `continue` inside it doesn't reach an enclosing loop.
+//? ============================================================
+# define OBF_SWITCH(...) for (svxor::StrSwitch svxor_sw(svxor::BUILD_KEY, __VA_ARGS__); svxor_sw.next(); ) switch (svxor_sw.hash())
+# define OBF_CASE(s) case svxor::hashStr(svxor::BUILD_KEY, s):
+# define OBF_CASE_V(s) OBF_CASE(s) if (!OBF_EQX(s, equals, svxor_sw.str(), svxor_sw.size())) { svxor_sw.reject(); break; }
 #endif
\ No newline at end of file
@@ -0,0 +1,210 @@
+/*
+ * MIT License
+ * Copyright © 2026 NyTekCFW
+ * See LICENSE file for details.
+*/
+
+#pragma once
+
+#ifndef SVXOR_BLOB_HPP
+# define SVXOR_BLOB_HPP
+
+# include "./svxor.hpp"
+
+//? ============================================================
+//? Compile-time obfuscated blobs (C++14 +)
+//?
+//? For payloads too large for ObfString (certificates, scripts,
+//? shaders...): the bytes are encrypted by a constexpr loop, no
+//? per-character template expansion.
+//?  - counter-mode keystream (svxor::ctrWord, same as KS_CTR):
+//?    any byte range is decrypted without touching the rest
+//?  - the blob itself is never decrypted in place: read() and
+//?    stream() write the plaintext to the caller, at most one
+//?    block (SVXOR_BLOB_BLOCK) of stack at a time
+//? ============================================================
+# if (__cplusplus >= 201402L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 201402L))
+#  define SVXOR_HAS_BLOB 1
+
+//? ============================================================
+//? stream() stack buffer size
+//? ============================================================
+#  ifndef SVXOR_BLOB_BLOCK
+#   define SVXOR_BLOB_BLOCK 1024
+#  endif
+
+namespace svxor
+{
+	template<size_t Bytes>
+	struct BlobSource
+	{
+		unsigned char	b[Bytes];
+	};
+
+	//? ============================================================
+	//? Copies a braced byte list (xxd -i, #embed) or, with
+	//? blobString(), a string literal (terminator dropped) into
+	//? a BlobSource.
+	//? Only ever evaluated at compile-time.
+	//? ============================================================
+	template<size_t Bytes>
+	inline constexpr BlobSource<Bytes> blobSource(const unsigned char (&b)[Bytes])
+	{
+		BlobSource<Bytes> r{};
+
+		for (size_t i = 0; i < Bytes; ++i)
+			r.b[i] = b[i];
+		return (r);
+	}
+
+	template<size_t N>
+	inline constexpr BlobSource<N - 1> blobString(const char (&s)[N])
+	{
+		BlobSource<N - 1> r{};
+
+		for (size_t i = 0; i < N - 1; ++i)
+			r.b[i] = static_cast<unsigned char>(s[i]);
+		return (r);
+	}
+
+	//? ============================================================
+	//? Runtime blob
+	//?
+	//? Constant-initialized and read-only: the ciphertext stays
+	//? in .rodata, concurrent readers need no synchronization.
+	//? ============================================================
+	template<size_t Bytes>
+	class ObfBlob
+	{
+	private:
+		unsigned char	_data[Bytes];
+		uint64_t		_key;
+	public:
+		constexpr ObfBlob(const BlobSource<Bytes>& src, uint64_t k) : _data{}, _key(k)
+		{
+			for (size_t j = 0; j < Bytes; j += 8)
+			{
+				const uint64_t ks = ctrWord(k, j >> 3);
+
+				for (size_t i = j; (i < j + 8) && (i < Bytes); ++i)
+					_data[i] = static_cast<unsigned char>(src.b[i] ^ uint8_t(ks >> ((i & 7) * 8)));
+			}
+		}
+
+		static inline constexpr size_t size(void)
+		{
+			return (Bytes);
+		}
+
+		//? ========================================================
+		//? Decrypts [offset, offset + len) into dst
+		//?
+		//? Clamped to the blob size, returns the number of bytes
+		//? written. Only the touched words are decrypted.
+		//? ========================================================
+		inline size_t read(size_t offset, size_t len, void* dst) const
+		{
+			if (offset >= Bytes)
+				return (0);
+			if (len > Bytes - offset)
+				len = Bytes - offset;
+			svxor::xorCtr(static_cast<char*>(dst), reinterpret_cast<const char*>(_data) + offset, _key, len, offset);
+			return (len);
+		}
+
+		//? ========================================================
+		//? Streams [offset, offset + len) to a consumer
+		//?
+		//? Calls fn(const char* chunk, size_t n) with at most
+		//? SVXOR_BLOB_BLOCK bytes at a time, from a stack buffer
+		//? that is cleared afterwards.
+		//? ========================================================
+		template<typename F>
+		inline void stream(F fn, size_t offset = 0, size_t len = size_t(-1)) const
+		{
+			char	buf[SVXOR_BLOB_BLOCK];
+
+			if (offset >= Bytes)
+				return;
+			if (len > Bytes - offset)
+				len = Bytes - offset;
+			for (size_t pos = offset; pos < offset + len; pos += SVXOR_BLOB_BLOCK)
+			{
+				const size_t n = ((offset + len - pos) < SVXOR_BLOB_BLOCK) ? (offset + len - pos) : SVXOR_BLOB_BLOCK;
+
+				svxor::xorCtr(buf, reinterpret_cast<const char*>(_data) + pos, _key, n, pos);
+				fn(static_cast<const char*>(buf), n);
+			}
+			svxor::secureWipe(buf, sizeof(buf));
+		}
+	};
+
+	//? ============================================================
+	//? Blob type of a definition struct (see OBF_BLOB)
+	//? ============================================================
+	template<size_t Bytes>
+	inline constexpr size_t blobBytes(const BlobSource<Bytes>&)
+	{
+		return (Bytes);
+	}
+
+	template<typename Def>
+	using ObfBlobOf = ObfBlob<blobBytes(Def::src())>;
+
+	//? forces the blob to be built by the compiler (pre-C++20)
+	template<typename Def>
+	inline constexpr bool blobBuilds(void)
+	{
+		return (ObfBlobOf<Def>(Def::src(), Def::key()).size() == blobBytes(Def::src()));
+	}
+}
+
+//! ============================================================
+//! MACROS
+//! ============================================================
+
+//? ============================================================
+//? OBF_BLOB(name, 0x2d, 0x2d, ...)    byte list (xxd -i < file)
+//? OBF_BLOB_STR(name, "literal")      string literal, no '\0'
+//? OBF_BLOB_DEF(name, def)            user definition struct
+//?
+//? Declares a constant-initialized, read-only blob `name`.
+//? #embed / #include can't appear inside a macro argument, so
+//? they go through a definition struct:
+//?
+//?   struct cert_def
+//?   {
+//?       static constexpr auto src(void) { return (svxor::blobSource({
+//?   #   include "cert.inc"
+//?       })); }
+//?       static constexpr uint64_t key(void) { return (OBF_SALT()); }
+//?   };
+//?   OBF_BLOB_DEF(g_cert, cert_def);
+//?
+//? Large payloads may need a higher constexpr budget
+//? (GCC: -fconstexpr-loop-limit / -fconstexpr-ops-limit,
+//?  Clang: -fconstexpr-steps).
+//? ============================================================
+#  ifdef SVXOR_HAS_CONSTINIT
+#   define SVXOR_BLOB_CHECK(def)
+#  else
+#   define SVXOR_BLOB_CHECK(def) static_assert(svxor::blobBuilds<def>(), "OBF_BLOB: not a constant expression");
+#  endif
+
+#  define OBF_BLOB_DEF(name, def) \
+	SVXOR_BLOB_CHECK(def) \
+	static SVXOR_CONSTINIT const svxor::ObfBlobOf<def> name(def::src(), def::key())
+
+#  define OBF_BLOBX(name, source) \
+	struct name##_def \
+	{ \
+		static constexpr auto src(void) { return (source); } \
+		static constexpr uint64_t key(void) { return (OBF_SALT()); } \
+	}; \
+	OBF_BLOB_DEF(name, name##_def)
+
+#  define OBF_BLOB(name, ...) OBF_BLOBX(name, svxor::blobSource({ __VA_ARGS__ }))
+#  define OBF_BLOB_STR(name, s) OBF_BLOBX(name, svxor::blobString(s))
+
+# endif
+#endif
@@ -0,0 +1,225 @@
+/*
+ * MIT License
+ * Copyright © 2026 NyTekCFW
+ * See LICENSE file for details.
+*/
+
+#pragma once
+
+#ifndef SVXOR_CATALOG_HPP
+# define SVXOR_CATALOG_HPP
+
+# include "./svxor.hpp"
+
+//? ============================================================
+//? Pre-encrypted string catalogs (tools/svxor_gen.cpp)
+//?
+//? The generator encrypts a catalog file offline and writes a
+//? header holding one xored blob, an entry table and an id
+//? index: the compiler only parses byte arrays, no per-literal
+//? template or constexpr work.
+//?  - entry bytes are the ObfString ciphertext of the literal
+//?    (KS_REGEN stream, KS_CTR per entry) with its own key
+//?  - obf_name() / by_index() are O(1), get(id) is O(1) on a
+//?    dense id range, a binary search otherwise
+//?  - every entry is decoded in place on first access (same
+//?    states as ObfTable), lock() relocks them all
+//?  - the catalog registers as one object once catalog() is
+//?    referenced (lock_all / unlock_all)
+//? C++11, constant-initialized, no heap.
+//? ============================================================
+
+namespace svxor
+{
+	struct CatalogEntry
+	{
+		uint32_t	id;
+		uint32_t	off;	//? in the blob
+		uint32_t	len;	//? terminator excluded
+		uint32_t	flags;	//? KS_REGEN [| KS_CTR]
+		uint64_t	key;	//? stream key
+	};
+
+	//? ============================================================
+	//? Runtime view of a generated catalog
+	//?
+	//? dense:  index[id - base] = entry + 1 (0 = absent)
+	//? sparse: index[] = entries sorted by id
+	//? ============================================================
+	class Catalog
+	{
+	private:
+		unsigned char*			_blob;
+		const CatalogEntry*		_entry;
+		std::atomic<uint8_t>*	_state;
+		const uint16_t*			_index;
+		uint32_t				_count;
+		uint32_t				_base;
+		uint32_t				_span;	//? 0: sparse index
+
+		inline char* str(const CatalogEntry& e) const
+		{
+			return (reinterpret_cast<char*>(_blob + e.off));
+		}
+
+		inline void xorEntry(const CatalogEntry& e)
+		{
+			char* p = str(e);
+
+			if (e.flags & KS_CTR)
+				Cipher<true>::xorAt(p, p, e.key, e.len, 0);
+			else
+				Cipher<false>::xorAt(p, p, e.key, e.len, 0);
+		}
+
+		inline const char* decode(size_t e)
+		{
+			if (_state[e].load(std::memory_order_acquire) == 2)
+				return (str(_entry[e]));
+			return (decodeSlow(e));
+		}
+
+		const char* decodeSlow(size_t e)
+		{
+			uint8_t		s = _state[e].load(std::memory_order_acquire);
+			unsigned	spins = 0;
+
+			while (s != 2)
+			{
+				if (!s && _state[e].compare_exchange_weak(s, 1, std::memory_order_acquire, std::memory_order_acquire))
+				{
+					xorEntry(_entry[e]);
+					_state[e].store(2, std::memory_order_release);
+					break;
+				}
+				if (s == 1)
+				{
+					cpuRelax(spins);
+					s = _state[e].load(std::memory_order_acquire);
+				}
+			}
+			return (str(_entry[e]));
+		}
+	public:
+		inline constexpr Catalog(unsigned char* blob, const CatalogEntry* entry, std::atomic<uint8_t>* state, const uint16_t* index, uint32_t count, uint32_t base, uint32_t span)
+			: _blob(blob), _entry(entry), _state(state), _index(index), _count(count), _base(base), _span(span) {}
+
+		inline constexpr size_t size(void) const
+		{
+			return (_count);
+		}
+
+		//? ========================================================
+		//? Entry index of id, size() when absent
+		//? ========================================================
+		inline size_t find(uint32_t id) const
+		{
+			if (_span)
+			{
+				const uint32_t	i = id - _base;
+
+				return ((i < _span && _index[i]) ? size_t(_index[i] - 1) : size_t(_count));
+			}
+
+			size_t	lo = 0;
+			size_t	hi = _count;
+
+			while (lo < hi)
+			{
+				const size_t	mid = (lo + hi) >> 1;
+
+				if (_entry[_index[mid]].id < id)
+					lo = mid + 1;
+				else
+					hi = mid;
+			}
+			return ((lo < _count && _entry[_index[lo]].id == id) ? size_t(_index[lo]) : size_t(_count));
+		}
+
+		//? ========================================================
+		//? Decoded string for id, nullptr when absent
+		//? ========================================================
+		inline const char* get(uint32_t id)
+		{
+			const size_t e = find(id);
+
+			return ((e < _count) ? decode(e) : nullptr);
+		}
+
+		//? decoded entry e (catalog order), nullptr past the end
+		inline const char* by_index(size_t e)
+		{
+			return ((e < _count) ? decode(e) : nullptr);
+		}
+
+		inline uint32_t id_of(size_t e) const
+		{
+			return (_entry[e].id);
+		}
+
+		inline size_t length(size_t e) const
+		{
+			return (_entry[e].len);
+		}
+
+		//? ========================================================
+		//? Calls fn(id, str) for every entry, catalog order
+		//? ========================================================
+		template<typename F>
+		inline void for_each(F fn)
+		{
+			for (size_t e = 0; e < _count; ++e)
+				fn(_entry[e].id, decode(e));
+		}
+
+		//? ========================================================
+		//? Decode every entry (startup pre-decode), returns the
+		//? first one, nullptr when empty
+		//? ========================================================
+		inline const char* unlock(void)
+		{
+			for (size_t e = 0; e < _count; ++e)
+				decode(e);
+			return (by_index(0));
+		}
+
+		//? ========================================================
+		//? Re-xor every decoded entry
+		//?
+		//? Same caveat as ObfTable::lock(): pointers returned by
+		//? get() read garbage afterwards.
+		//? ========================================================
+		inline void lock(void)
+		{
+			for (size_t e = 0; e < _count; ++e)
+			{
+				uint8_t s = 2;
+
+				if (_state[e].compare_exchange_strong(s, 1, std::memory_order_acquire))
+				{
+					xorEntry(_entry[e]);
+					_state[e].store(0, std::memory_order_release);
+				}
+			}
+		}
+	};
+
+# ifdef SVXOR_HAS_REGISTRY
+	//? one descriptor per catalog (regEntry(cat, total length))
+	template<>
+	struct RegOps<Catalog>
+	{
+		static const char* unlock(void* p)
+		{
+			return (static_cast<Catalog*>(p)->unlock());
+		}
+
+		static void lock(void* p)
+		{
+			static_cast<Catalog*>(p)->lock();
+		}
+	};
+# endif
+}
+
+#endif
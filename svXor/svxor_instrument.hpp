@@ -0,0 +1,241 @@
+/*
+ * MIT License
+ * Copyright © 2026 NyTekCFW
+ * See LICENSE file for details.
+*/
+
+#pragma once
+
+#ifndef SVXOR_INSTRUMENT_HPP
+# define SVXOR_INSTRUMENT_HPP
+
+//? ============================================================
+//? Per call site instrumentation (-DSVXOR_INSTRUMENT)
+//?
+//? Included by svxor.hpp, never on its own. Every OBF / OBF_ST /
+//? OBF_STC / OBF_STT call site gets a Site tagged with its salt
+//? and __FILE__ / __LINE__, counting:
+//?  - decodes / relocks / wipes (destructor)
+//?  - ticks spent in xor passes and wipes
+//?  - ticks spent unlocked (unlock -> lock or destruction)
+//? Ticks are TSC cycles on x86, nanoseconds elsewhere.
+//? Counters live in relaxed per-thread shards (one cache line
+//? each), summed on read. Without SVXOR_INSTRUMENT none of
+//? this is compiled.
+//? ============================================================
+
+# include <cstdio>
+# include <chrono>
+
+# if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#  define SVXOR_STAT_TSC 1
+# elif defined(_M_X64) || defined(_M_IX86)
+#  include <intrin.h>
+#  define SVXOR_STAT_TSC 1
+# endif
+
+//? ============================================================
+//? Shards per site (threads are spread round-robin)
+//? ============================================================
+# ifndef SVXOR_STAT_SHARDS
+#  define SVXOR_STAT_SHARDS 8
+# endif
+
+namespace svxor
+{
+	inline uint64_t statTicks(void)
+	{
+# if defined(SVXOR_STAT_TSC) && (defined(__GNUC__) || defined(__clang__))
+		return (__builtin_ia32_rdtsc());
+# elif defined(SVXOR_STAT_TSC)
+		return (__rdtsc());
+# else
+		return (uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()));
+# endif
+	}
+
+	//? shard of the calling thread
+	inline unsigned statShard(void)
+	{
+		static std::atomic<unsigned>	next(0);
+		static thread_local unsigned	idx = next.fetch_add(1, std::memory_order_relaxed) % SVXOR_STAT_SHARDS;
+
+		return (idx);
+	}
+
+	enum StatEvent : unsigned
+	{
+		STAT_DECODE = 0,
+		STAT_RELOCK,
+		STAT_WIPE,
+		STAT_EVENTS
+	};
+
+	//? ============================================================
+	//? Summed counters of one site (see stats_for_each)
+	//? ============================================================
+	struct SiteStats
+	{
+		const char*	file;
+		int			line;
+		uint64_t	salt;
+		uint64_t	count[STAT_EVENTS];		//? decodes, relocks, wipes
+		uint64_t	ticks[STAT_EVENTS];		//? in xor passes / wipes
+		uint64_t	unlockedTicks;
+	};
+
+	class Site
+	{
+	private:
+		struct alignas(SVXOR_CACHE_LINE) Shard
+		{
+			std::atomic<uint64_t>	count[STAT_EVENTS];
+			std::atomic<uint64_t>	ticks[STAT_EVENTS];
+			std::atomic<uint64_t>	unlocked;
+		};
+
+		const char*			_file;
+		int					_line;
+		uint64_t			_salt;
+		std::atomic<bool>	_linked;
+		Site*				_next;
+		Shard				_shards[SVXOR_STAT_SHARDS];
+
+		static inline std::atomic<Site*>& head(void)
+		{
+			static std::atomic<Site*>	h(nullptr);
+
+			return (h);
+		}
+
+		//? joins the dump list on the first event
+		inline void link(void)
+		{
+			bool	expected = false;
+			Site*	h;
+
+			if (_linked.load(std::memory_order_relaxed) || !_linked.compare_exchange_strong(expected, true, std::memory_order_relaxed))
+				return;
+			h = head().load(std::memory_order_relaxed);
+			do
+				_next = h;
+			while (!head().compare_exchange_weak(h, this, std::memory_order_release, std::memory_order_relaxed));
+		}
+
+		static inline void add(std::atomic<uint64_t>& c, uint64_t v)
+		{
+			c.fetch_add(v, std::memory_order_relaxed);
+		}
+	public:
+		constexpr Site(const char* file, int line, uint64_t salt) : _file(file), _line(line), _salt(salt), _linked(false), _next(nullptr), _shards{} {}
+
+		inline void record(StatEvent e, uint64_t ticks)
+		{
+			Shard&	s = _shards[statShard()];
+
+			link();
+			add(s.count[e], 1);
+			add(s.ticks[e], ticks);
+		}
+
+		inline void recordUnlocked(uint64_t ticks)
+		{
+			add(_shards[statShard()].unlocked, ticks);
+		}
+
+		inline SiteStats snapshot(void) const
+		{
+			SiteStats	r = { _file, _line, _salt, { 0 }, { 0 }, 0 };
+
+			for (const Shard& s : _shards)
+			{
+				for (unsigned e = 0; e < STAT_EVENTS; ++e)
+				{
+					r.count[e] += s.count[e].load(std::memory_order_relaxed);
+					r.ticks[e] += s.ticks[e].load(std::memory_order_relaxed);
+				}
+				r.unlockedTicks += s.unlocked.load(std::memory_order_relaxed);
+			}
+			return (r);
+		}
+
+		template<typename F>
+		static inline void for_each(F fn)
+		{
+			for (Site* p = head().load(std::memory_order_acquire); p; p = p->_next)
+				fn(static_cast<const Site&>(*p));
+		}
+	};
+
+	//? ============================================================
+	//? Calls fn(const SiteStats&) for every site with events
+	//? ============================================================
+	template<typename F>
+	inline void stats_for_each(F fn)
+	{
+		Site::for_each([&fn](const Site& s) { fn(s.snapshot()); });
+	}
+
+	inline const char* statTickUnit(void)
+	{
+# ifdef SVXOR_STAT_TSC
+		return ("cycles");
+# else
+		return ("ns");
+# endif
+	}
+
+	//? __FILE__ quoting: JSON escapes '"' and '\\', CSV doubles '"'
+	inline void statFile(FILE* f, const char* s, bool csv)
+	{
+		for (; *s; ++s)
+		{
+			if (*s == '"' || (!csv && *s == '\\'))
+				std::fputc(csv ? '"' : '\\', f);
+			std::fputc(*s, f);
+		}
+	}
+
+	//? ============================================================
+	//? Dumps every site with events
+	//?
+	//? JSON: { "ticks": "cycles", "sites": [ { ... }, ... ] }
+	//? CSV:  header line, one line per site
+	//? ============================================================
+	inline void stats_json(FILE* f)
+	{
+		bool	first = true;
+
+		std::fprintf(f, "{\n  \"ticks\": \"%s\",\n  \"sites\": [", statTickUnit());
+		stats_for_each([f, &first](const SiteStats& s)
+		{
+			std::fprintf(f, "%s\n    {\"file\": \"", first ? "" : ",");
+			statFile(f, s.file, false);
+			std::fprintf(f, "\", \"line\": %d, \"salt\": \"0x%016llx\", \"decodes\": %llu, \"relocks\": %llu, \"wipes\": %llu, "
+				"\"decode_ticks\": %llu, \"relock_ticks\": %llu, \"wipe_ticks\": %llu, \"unlocked_ticks\": %llu}",
+				s.line, (unsigned long long)s.salt,
+				(unsigned long long)s.count[STAT_DECODE], (unsigned long long)s.count[STAT_RELOCK], (unsigned long long)s.count[STAT_WIPE],
+				(unsigned long long)s.ticks[STAT_DECODE], (unsigned long long)s.ticks[STAT_RELOCK], (unsigned long long)s.ticks[STAT_WIPE],
+				(unsigned long long)s.unlockedTicks);
+			first = false;
+		});
+		std::fprintf(f, "\n  ]\n}\n");
+	}
+
+	inline void stats_csv(FILE* f)
+	{
+		std::fprintf(f, "file,line,salt,decodes,relocks,wipes,decode_ticks,relock_ticks,wipe_ticks,unlocked_ticks\n");
+		stats_for_each([f](const SiteStats& s)
+		{
+			std::fputc('"', f);
+			statFile(f, s.file, true);
+			std::fprintf(f, "\",%d,0x%016llx,%llu,%llu,%llu,%llu,%llu,%llu,%llu\n",
+				s.line, (unsigned long long)s.salt,
+				(unsigned long long)s.count[STAT_DECODE], (unsigned long long)s.count[STAT_RELOCK], (unsigned long long)s.count[STAT_WIPE],
+				(unsigned long long)s.ticks[STAT_DECODE], (unsigned long long)s.ticks[STAT_RELOCK], (unsigned long long)s.ticks[STAT_WIPE],
+				(unsigned long long)s.unlockedTicks);
+		});
+	}
+}
+
+#endif
@@ -0,0 +1,309 @@
+/*
+ * MIT License
+ * Copyright © 2026 NyTekCFW
+ * See LICENSE file for details.
+*/
+
+#pragma once
+
+#ifndef SVXOR_IO_HPP
+# define SVXOR_IO_HPP
+
+# include "./svxor.hpp"
+# include <cstdio>
+# include <ostream>
+# include <string>
+
+//? ============================================================
+//? printf / ostream adapters
+//?
+//?   svxor::printf(OBF_FMT("%s: %d\n"), OBF_FMT("retries"), n);
+//?   svxor::fprintf(std::cerr, OBF_FMT("[%s] "), tag);
+//?   std::cout << OBF_FMT("Current: ") << x.c_str();
+//?
+//? The format and every ObfString argument are decoded with
+//? decode_to() into one stack scratch sized at compile-time
+//? (no truncation, objects left locked) and wiped after the
+//? call. FILE output is formatted by stdio straight into the
+//? stream buffer; ostream output goes through a stack buffer
+//? and one sputn (a wiped heap string past SVXOR_IO_BUF).
+//? No heap allocation otherwise, and with OBF_FMT no object to
+//? build, pin or wipe (per call site read-only literal).
+//? ============================================================
+
+//? ============================================================
+//? Stack output buffer (fprintf to an ostream)
+//? ============================================================
+# ifndef SVXOR_IO_BUF
+#  define SVXOR_IO_BUF 512
+# endif
+
+namespace svxor
+{
+	//? ============================================================
+	//? Read-only literal (see OBF_FMT)
+	//?
+	//? Constant ciphertext + KS_REGEN key in .rodata, no state
+	//? word: only ever decoded into a caller buffer, so readers
+	//? need no pin and nothing can relock it underneath.
+	//? ============================================================
+	template<size_t N>
+	struct FmtLiteral
+	{
+		Encoded<N>	e;
+		uint64_t	k;
+
+		static inline constexpr size_t size(void)
+		{
+			return (N);
+		}
+
+		//? same contract as ObfString::decode_to
+		inline size_t decode_to(char* dst, size_t cap) const
+		{
+			if (!cap)
+				return (0);
+
+			const char*		src = e.d;
+			const size_t	n = (cap - 1 < N) ? (cap - 1) : N;
+
+			//? a constant object: hide it, or the xor is folded
+			SVXOR_OPAQUE(src);
+			svxor::xorMix(dst, src, k, n);
+			dst[n] = '\0';
+			return (n);
+		}
+	};
+
+	//? ============================================================
+	//? Scratch bytes of an argument: size() + 1 for a char
+	//? ObfString or literal, 0 for anything else (passed through)
+	//? ============================================================
+	template<typename T>
+	struct IoBytes
+	{
+		static constexpr size_t value = 0;
+	};
+
+	template<size_t N>
+	struct IoBytes<FmtLiteral<N>>
+	{
+		static constexpr size_t value = N + 1;
+	};
+
+	template<typename L, bool isHeavy, uint32_t Flags>
+	struct IoBytes<ObfString<L, isHeavy, Flags, char>>
+	{
+		static constexpr size_t value = ObfString<L, isHeavy, Flags, char>::size() + 1;
+	};
+
+	template<typename... T> struct IoSum;
+
+	template<>
+	struct IoSum<>
+	{
+		static constexpr size_t value = 0;
+	};
+
+	template<typename T, typename... R>
+	struct IoSum<T, R...>
+	{
+		static constexpr size_t value = IoBytes<typename std::decay<T>::type>::value + IoSum<R...>::value;
+	};
+
+	//? ============================================================
+	//? printf argument: literals and ObfStrings are decoded at cur
+	//? (advanced), the rest is forwarded unchanged
+	//? ============================================================
+	template<size_t N>
+	inline const char* ioArg(const FmtLiteral<N>& s, char*& cur)
+	{
+		char* p = cur;
+
+		cur += s.decode_to(p, N + 1) + 1;
+		return (p);
+	}
+
+	template<typename L, bool isHeavy, uint32_t Flags>
+	inline const char* ioArg(ObfString<L, isHeavy, Flags, char>& s, char*& cur)
+	{
+		char* p = cur;
+
+		cur += s.decode_to(p, s.size() + 1) + 1;
+		return (p);
+	}
+
+	template<typename L, bool isHeavy, uint32_t Flags>
+	inline const char* ioArg(ObfString<L, isHeavy, Flags, char>&& s, char*& cur)
+	{
+		return (ioArg(s, cur));
+	}
+
+	template<typename T>
+	inline T&& ioArg(T&& v, char*&)
+	{
+		return (static_cast<T&&>(v));
+	}
+
+# if defined(__GNUC__) || defined(__clang__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wformat-nonliteral"
+#  pragma GCC diagnostic ignored "-Wformat-security"
+# endif
+	//? ============================================================
+	//? Decodes format + arguments into the scratch, then calls
+	//? out(const char* fmt, args...) with plain pointers
+	//? ============================================================
+	template<typename Fmt, typename... Args, typename F>
+	inline int ioFormat(F out, Fmt&& fmt, Args&&... args)
+	{
+		static_assert(IoBytes<typename std::decay<Fmt>::type>::value != 0, "svxor: the format must be OBF_FMT or a char ObfString");
+
+		char	scratch[IoSum<Fmt, Args...>::value];
+		char*	cur = scratch;
+		int		r;
+
+		ioArg(fmt, cur);
+		r = out(static_cast<const char*>(scratch), ioArg(static_cast<Args&&>(args), cur)...);
+		svxor::secureWipe(scratch, sizeof(scratch));
+		return (r);
+	}
+
+	//? ============================================================
+	//? Output stages (plain format + arguments from ioFormat)
+	//? ============================================================
+
+	//? bytes snprintf wrote into a cap byte buffer (terminator
+	//? included): all that needs wiping
+	inline size_t ioWritten(int n, size_t cap)
+	{
+		return ((n < 0) ? cap : ((size_t(n) < cap) ? size_t(n) + 1 : cap));
+	}
+
+	struct IoString
+	{
+		char*	dst;
+		size_t	cap;
+
+		template<typename... A>
+		inline int operator()(const char* f, A... a) const
+		{
+			return (std::snprintf(dst, cap, f, a...));
+		}
+	};
+
+	//? stdio formats straight into the FILE buffer (one lock)
+	struct IoFile
+	{
+		FILE*	file;
+
+		template<typename... A>
+		inline int operator()(const char* f, A... a) const
+		{
+			return (std::fprintf(file, f, a...));
+		}
+	};
+
+	//? one sputn, heap string (wiped) when longer than the buffer
+	struct IoStream
+	{
+		std::ostream*	os;
+
+		template<typename... A>
+		inline int operator()(const char* f, A... a) const
+		{
+			char	buf[SVXOR_IO_BUF];
+			int		n = std::snprintf(buf, sizeof(buf), f, a...);
+
+			if (n >= int(sizeof(buf)))
+			{
+				std::string	big(size_t(n) + 1, '\0');
+
+				std::snprintf(&big[0], big.size(), f, a...);
+				os->write(big.data(), n);
+				svxor::secureWipe(&big[0], big.size());
+			}
+			else if (n > 0)
+				os->write(buf, n);
+			svxor::secureWipe(buf, ioWritten(n, sizeof(buf)));
+			return (n);
+		}
+	};
+# if defined(__GNUC__) || defined(__clang__)
+#  pragma GCC diagnostic pop
+# endif
+
+	//? ============================================================
+	//? std::snprintf / fprintf / printf with an obfuscated format
+	//? and arguments, same return values
+	//? ============================================================
+	template<typename Fmt, typename... Args>
+	inline int snprintf(char* dst, size_t cap, Fmt&& fmt, Args&&... args)
+	{
+		return (ioFormat(IoString{ dst, cap }, static_cast<Fmt&&>(fmt), static_cast<Args&&>(args)...));
+	}
+
+	template<typename Fmt, typename... Args>
+	inline int fprintf(FILE* file, Fmt&& fmt, Args&&... args)
+	{
+		return (ioFormat(IoFile{ file }, static_cast<Fmt&&>(fmt), static_cast<Args&&>(args)...));
+	}
+
+	template<typename Fmt, typename... Args>
+	inline int printf(Fmt&& fmt, Args&&... args)
+	{
+		return (ioFormat(IoFile{ stdout }, static_cast<Fmt&&>(fmt), static_cast<Args&&>(args)...));
+	}
+
+	//? printf to an ostream (characters written, like fprintf)
+	template<typename Fmt, typename... Args>
+	inline int fprintf(std::ostream& os, Fmt&& fmt, Args&&... args)
+	{
+		return (ioFormat(IoStream{ &os }, static_cast<Fmt&&>(fmt), static_cast<Args&&>(args)...));
+	}
+
+	//? ============================================================
+	//? os << obj: exact-size stack copy, one sputn, wiped
+	//? ============================================================
+	template<size_t N>
+	inline std::ostream& operator<<(std::ostream& os, const FmtLiteral<N>& s)
+	{
+		char	buf[N + 1];
+
+		os.write(buf, std::streamsize(s.decode_to(buf, sizeof(buf))));
+		svxor::secureWipe(buf, sizeof(buf));
+		return (os);
+	}
+
+	template<typename L, bool isHeavy, uint32_t Flags>
+	inline std::ostream& operator<<(std::ostream& os, ObfString<L, isHeavy, Flags, char>& s)
+	{
+		char	buf[ObfString<L, isHeavy, Flags, char>::size() + 1];
+
+		os.write(buf, std::streamsize(s.decode_range(0, s.size(), buf)));
+		svxor::secureWipe(buf, sizeof(buf));
+		return (os);
+	}
+
+	template<typename L, bool isHeavy, uint32_t Flags>
+	inline std::ostream& operator<<(std::ostream& os, ObfString<L, isHeavy, Flags, char>&& s)
+	{
+		return (os << s);
+	}
+}
+
+//! ============================================================
+//! MACROS
+//! ============================================================
+
+//? ============================================================
+//? OBF_FMT("literal")
+//?
+//? Format / argument literal for the adapters: per call site
+//? constant FmtLiteral (ciphertext + key, read-only), decoded
+//? into the caller's scratch only. Safe from any thread, works
+//? on SNC (no static object to construct).
+//? ============================================================
+# define OBF_FMT(s) ([]() -> const svxor::FmtLiteral<sizeof(s) - 1>& { static constexpr uint64_t k = OBF_SALT(); static constexpr svxor::FmtLiteral<sizeof(s) - 1> lit = { OBF_ENCODE(s, svxor::KS_REGEN, k), svxor::streamKey<svxor::KS_REGEN>(k) }; return (lit); }())
+
+#endif
@@ -0,0 +1,411 @@
+/*
+ * MIT License
+ * Copyright © 2026 NyTekCFW
+ * See LICENSE file for details.
+*/
+
+#pragma once
+
+#ifndef SVXOR_TABLE_HPP
+# define SVXOR_TABLE_HPP
+
+# include "./svxor.hpp"
+
+//? ============================================================
+//? Compile-time obfuscated string table (C++14 +)
+//?
+//? (id, literal) pairs are packed into one contiguous xored
+//? blob with an offset/length index and a perfect hash on the
+//? ids, all built at compile-time:
+//?  - get(id) is O(1): two hash mixes, one slot, one id check
+//?  - for_each() walks the entries in declaration order
+//?  - every entry is decoded in place on first access
+//?  - the table registers as one object (lock_all / unlock_all)
+//? ============================================================
+# if (__cplusplus >= 201402L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 201402L))
+#  define SVXOR_HAS_TABLE 1
+
+namespace svxor
+{
+	struct TableEntry
+	{
+		uint32_t	id;
+		const char*	s;
+	};
+
+	template<size_t Count>
+	struct TableSource
+	{
+		TableEntry	e[Count];
+	};
+
+	//? ============================================================
+	//? Copies a braced (id, literal) list into a TableSource.
+	//? Only ever evaluated at compile-time: the literals are
+	//? never referenced by the binary.
+	//? ============================================================
+	template<size_t Count>
+	inline constexpr TableSource<Count> tableSource(const TableEntry (&e)[Count])
+	{
+		TableSource<Count> r{};
+
+		for (size_t i = 0; i < Count; ++i)
+			r.e[i] = e[i];
+		return (r);
+	}
+
+	//? blob size: every literal + its terminator
+	template<size_t Count>
+	inline constexpr size_t tableBytes(const TableSource<Count>& src)
+	{
+		size_t n = 0;
+
+		for (size_t i = 0; i < Count; ++i)
+		{
+			for (const char* s = src.e[i].s; *s; ++s)
+				++n;
+			++n;
+		}
+		return (n);
+	}
+
+	inline constexpr size_t pow2Ceil(size_t n)
+	{
+		size_t p = 1;
+
+		while (p < n)
+			p <<= 1;
+		return (p);
+	}
+
+	//? ============================================================
+	//? Stops constant evaluation with a readable trace
+	//? (duplicate id, table too large...).
+	//? ============================================================
+	inline constexpr int tableError(const char* why)
+	{
+		return (why[-1]);
+	}
+
+	//? per entry key
+	inline constexpr uint64_t tableKey(uint64_t key, uint32_t id)
+	{
+		return (mix64(key ^ (uint64_t(id) * 0x9E3779B97F4A7C15ULL)));
+	}
+
+	//? ============================================================
+	//? Compile-time image of a table
+	//?
+	//? Hash and displace: ids are spread over Buckets, each
+	//? bucket gets a displacement that sends its ids to free
+	//? slots (largest buckets placed first).
+	//? ============================================================
+	template<size_t Count, size_t Bytes>
+	struct ObfTableImage
+	{
+		static constexpr size_t	Slots = pow2Ceil(Count + Count / 4 + 1);
+		static constexpr size_t	Buckets = pow2Ceil(Count / 4 + 1);
+
+		char		blob[Bytes];
+		uint32_t	id[Count];
+		uint32_t	off[Count];
+		uint32_t	len[Count];
+		uint16_t	slot[Slots];
+		uint16_t	disp[Buckets];
+		uint64_t	key;
+		uint64_t	seed;
+
+		constexpr ObfTableImage(const TableSource<Count>& src, uint64_t k) : blob{}, id{}, off{}, len{}, slot{}, disp{}, key(k), seed(0)
+		{
+			size_t pos = 0;
+
+			if (Count >= 0xFFFF)
+				tableError("too many entries");
+			for (size_t e = 0; e < Count; ++e)
+			{
+				const char*	s = src.e[e].s;
+				size_t		n = 0;
+
+				while (s[n])
+					++n;
+				id[e] = src.e[e].id;
+				off[e] = uint32_t(pos);
+				len[e] = uint32_t(n);
+				for (size_t j = 0; j < n; ++j)
+					blob[pos + j] = xorChar(s[j], tableKey(key, id[e]), int(j));
+				pos += n + 1;
+			}
+			while (!buildIndex())
+				seed = mix64(seed + 1);
+		}
+
+		//? one multiply per level (Fibonacci hashing, high bits)
+		inline constexpr uint64_t idHash(uint32_t i) const
+		{
+			return ((uint64_t(i) ^ seed) * 0x9E3779B97F4A7C15ULL);
+		}
+
+		inline constexpr size_t bucketOf(uint64_t h) const
+		{
+			return (size_t(h >> 40) & (Buckets - 1));
+		}
+
+		inline constexpr size_t slotOf(uint64_t h, uint16_t d) const
+		{
+			return (size_t(((h + d) * 0xD6E8FEB86659FD93ULL) >> 40) & (Slots - 1));
+		}
+
+		//? entry index of id, or Count
+		inline constexpr size_t find(uint32_t i) const
+		{
+			const uint64_t	h = idHash(i);
+			const uint16_t	e = slot[slotOf(h, disp[bucketOf(h)])];
+
+			return ((e && (id[e - 1] == i)) ? (e - 1) : Count);
+		}
+
+		constexpr bool buildIndex(void)
+		{
+			uint16_t	start[Buckets + 1] = {};
+			uint16_t	order[Count] = {};
+			uint16_t	fill[Buckets] = {};
+			size_t		largest = 0;
+
+			for (size_t i = 0; i < Slots; ++i)
+				slot[i] = 0;
+			for (size_t e = 0; e < Count; ++e)
+				++start[bucketOf(idHash(id[e])) + 1];
+			for (size_t b = 0; b < Buckets; ++b)
+			{
+				largest = (start[b + 1] > largest) ? start[b + 1] : largest;
+				start[b + 1] += start[b];
+			}
+			for (size_t e = 0; e < Count; ++e)
+			{
+				size_t b = bucketOf(idHash(id[e]));
+
+				for (size_t k = start[b]; k < size_t(start[b] + fill[b]); ++k)
+				{
+					if (id[order[k]] == id[e])
+						tableError("duplicate id");
+				}
+				order[start[b] + fill[b]++] = uint16_t(e);
+			}
+			for (size_t size = largest; size > 0; --size)
+			{
+				for (size_t b = 0; b < Buckets; ++b)
+				{
+					if (fill[b] != size)
+						continue;
+					uint32_t d = 0;
+					for (; d <= 0xFFFF; ++d)
+					{
+						size_t placed = 0;
+
+						for (; placed < size; ++placed)
+						{
+							size_t s = slotOf(idHash(id[order[start[b] + placed]]), uint16_t(d));
+
+							if (slot[s])
+								break;
+							slot[s] = uint16_t(order[start[b] + placed] + 1);
+						}
+						if (placed == size)
+							break;
+						while (placed--)
+							slot[slotOf(idHash(id[order[start[b] + placed]]), uint16_t(d))] = 0;
+					}
+					if (d > 0xFFFF)
+						return (false);
+					disp[b] = uint16_t(d);
+				}
+			}
+			return (true);
+		}
+	};
+
+	//? ============================================================
+	//? Runtime table
+	//?
+	//? Constant-initialized copy of the image plus one decode
+	//? state per entry (0 locked, 1 busy, 2 unlocked).
+	//? ============================================================
+	template<size_t Count, size_t Bytes>
+	class ObfTable
+	{
+	public:
+		typedef ObfTableImage<Count, Bytes> Image;
+	private:
+		Image					_img;
+		std::atomic<uint8_t>	_state[Count];
+
+		inline const char* decode(size_t e)
+		{
+			char* p = _img.blob + _img.off[e];
+
+			if (_state[e].load(std::memory_order_acquire) == 2)
+				return (p);
+			return (decodeSlow(e, p));
+		}
+
+		const char* decodeSlow(size_t e, char* p)
+		{
+			uint8_t		s = _state[e].load(std::memory_order_acquire);
+			unsigned	spins = 0;
+
+			while (s != 2)
+			{
+				if (!s && _state[e].compare_exchange_weak(s, 1, std::memory_order_acquire, std::memory_order_acquire))
+				{
+					svxor::xorMix(p, tableKey(_img.key, _img.id[e]), _img.len[e]);
+					_state[e].store(2, std::memory_order_release);
+					break;
+				}
+				if (s == 1)
+				{
+					cpuRelax(spins);
+					s = _state[e].load(std::memory_order_acquire);
+				}
+			}
+			return (p);
+		}
+	public:
+		inline constexpr explicit ObfTable(const Image& img) : _img(img), _state{} {}
+
+		inline constexpr size_t size(void) const
+		{
+			return (Count);
+		}
+
+		//? ========================================================
+		//? Decoded string for id, nullptr when absent
+		//? ========================================================
+		inline const char* get(uint32_t id)
+		{
+			const size_t e = _img.find(id);
+
+			return ((e < Count) ? decode(e) : nullptr);
+		}
+
+		//? ========================================================
+		//? Calls fn(id, str) for every entry, declaration order
+		//? ========================================================
+		template<typename F>
+		inline void for_each(F fn)
+		{
+			for (size_t e = 0; e < Count; ++e)
+				fn(_img.id[e], decode(e));
+		}
+
+		//? ========================================================
+		//? Decode every entry (startup pre-decode), returns the
+		//? first one
+		//? ========================================================
+		inline const char* unlock(void)
+		{
+			for (size_t e = 0; e < Count; ++e)
+				decode(e);
+			return (_img.blob);
+		}
+
+		//? ========================================================
+		//? Re-xor every decoded entry
+		//?
+		//? Same caveat as ObfString::c_str(): pointers returned
+		//? by get() read garbage afterwards.
+		//? ========================================================
+		inline void lock(void)
+		{
+			for (size_t e = 0; e < Count; ++e)
+			{
+				uint8_t s = 2;
+
+				if (_state[e].compare_exchange_strong(s, 1, std::memory_order_acquire))
+				{
+					svxor::xorMix(_img.blob + _img.off[e], tableKey(_img.key, _img.id[e]), _img.len[e]);
+					_state[e].store(0, std::memory_order_release);
+				}
+			}
+		}
+	};
+
+	//? ============================================================
+	//? Table type of a definition struct (see OBF_TABLE)
+	//? ============================================================
+	template<size_t Count>
+	inline constexpr size_t tableCount(const TableSource<Count>&)
+	{
+		return (Count);
+	}
+
+	template<typename Def>
+	using ObfTableOf = ObfTable<tableCount(Def::src()), tableBytes(Def::src())>;
+
+#  ifdef SVXOR_HAS_REGISTRY
+	//? one descriptor per table, size(): entry characters
+	template<size_t Count, size_t Bytes>
+	struct RegOps<ObfTable<Count, Bytes>>
+	{
+		static const char* unlock(void* p)
+		{
+			return (static_cast<ObfTable<Count, Bytes>*>(p)->unlock());
+		}
+
+		static void lock(void* p)
+		{
+			static_cast<ObfTable<Count, Bytes>*>(p)->lock();
+		}
+	};
+
+	template<size_t Count, size_t Bytes>
+	inline constexpr RegEntry regEntry(ObfTable<Count, Bytes>& t)
+	{
+		return (regEntry(t, Bytes - Count));
+	}
+#  endif
+
+	//? forces the image to be built by the compiler (pre-C++20)
+	template<typename Def>
+	inline constexpr bool tableBuilds(void)
+	{
+		return (typename ObfTableOf<Def>::Image(Def::src(), Def::key()).key == Def::key());
+	}
+}
+
+//! ============================================================
+//! MACROS
+//! ============================================================
+
+//? ============================================================
+//? OBF_TABLE(name, { id, "literal" }, ...)
+//?
+//? Declares a constant-initialized static table `name`,
+//? registered like OBF_STC.
+//? The literals only live in constexpr functions, which are
+//? never emitted (no plaintext in the binary, even at -O0).
+//? Before C++20 a static_assert stands in for constinit.
+//? ============================================================
+#  ifdef SVXOR_HAS_CONSTINIT
+#   define SVXOR_TABLE_CHECK(def)
+#  else
+#   define SVXOR_TABLE_CHECK(def) static_assert(svxor::tableBuilds<def>(), "OBF_TABLE: not a constant expression");
+#  endif
+#  ifdef SVXOR_HAS_REGISTRY
+#   define SVXOR_TABLE_REGISTER(name) SVXOR_REGISTER(name)
+#  else
+#   define SVXOR_TABLE_REGISTER(name)
+#  endif
+
+#  define OBF_TABLE(name, ...) \
+	struct name##_def \
+	{ \
+		static constexpr auto src(void) { return (svxor::tableSource({ __VA_ARGS__ })); } \
+		static constexpr uint64_t key(void) { return (OBF_SALT()); } \
+	}; \
+	SVXOR_TABLE_CHECK(name##_def) \
+	static SVXOR_CONSTINIT svxor::ObfTableOf<name##_def> name(svxor::ObfTableOf<name##_def>::Image(name##_def::src(), name##_def::key())); \
+	SVXOR_TABLE_REGISTER(name) \
+	static_assert(true, "")
+
+# endif
+#endif
@@ -0,0 +1,317 @@
+/*
+ * MIT License
+ * Copyright © 2026 NyTekCFW
+ * See LICENSE file for details.
+*/
+
+#pragma once
+
+#ifndef SVXOR_TTL_HPP
+# define SVXOR_TTL_HPP
+
+# include "./svxor.hpp"
+
+//? ============================================================
+//? Timed relock (plaintext TTL) for static strings
+//?
+//? OBF_STT strings stay decoded while in use and are relocked by
+//? a sweeper thread once idle for `ms` milliseconds:
+//?  - an access is a relaxed load of the sweeper clock and, at
+//?    most once per tick, a seq_cst store: no atomic RMW on the
+//?    hot path
+//?  - a string joins the sweep list on its first access (one
+//?    CAS, ever), strings never used are never swept
+//?  - the sweeper only relocks with try_lock(): strings pinned
+//?    by read() are left alone until the next tick
+//?  - an access racing the sweep wins: the sweeper re-reads the
+//?    last access once it owns the string and backs out
+//?
+//? Pointers from c_str() are not pinned: use them within the TTL
+//? (keep ms above the tick) or go through read() (pinned, never
+//? relocked underneath).
+//? Without a running sweeper (ttl_start) nothing is relocked.
+//? ============================================================
+# ifndef __SNC__
+#  define SVXOR_HAS_TTL 1
+
+#  include <chrono>
+#  include <mutex>
+
+namespace svxor
+{
+	//? ============================================================
+	//? Sweeper clock (ms since ttl_start, advanced every tick)
+	//? ============================================================
+	inline std::atomic<uint32_t>& ttlNow(void)
+	{
+		static std::atomic<uint32_t>	now(0);
+
+		return (now);
+	}
+
+	//? ============================================================
+	//? Sweep list node, one per OBF_STT string
+	//? ============================================================
+	class TtlSlot
+	{
+	private:
+		void*					_obj;
+		bool					(*_tryLock)(void*, const std::atomic<uint32_t>&, uint32_t);
+		void					(*_lock)(void*);
+		uint32_t				_ttl;
+		std::atomic<uint32_t>	_last;
+		std::atomic<bool>		_linked;
+		TtlSlot*				_next;
+
+		static inline std::atomic<TtlSlot*>& head(void)
+		{
+			static std::atomic<TtlSlot*>	h(nullptr);
+
+			return (h);
+		}
+
+		inline void link(void)
+		{
+			bool		expected = false;
+			TtlSlot*	h;
+
+			if (!_linked.compare_exchange_strong(expected, true, std::memory_order_relaxed))
+				return;
+			h = head().load(std::memory_order_relaxed);
+			do
+				_next = h;
+			while (!head().compare_exchange_weak(h, this, std::memory_order_release, std::memory_order_relaxed));
+		}
+	public:
+		constexpr TtlSlot(void* obj, bool (*tryLock)(void*, const std::atomic<uint32_t>&, uint32_t), void (*lock)(void*), uint32_t ms)
+			: _obj(obj), _tryLock(tryLock), _lock(lock), _ttl(ms), _last(0), _linked(false), _next(nullptr) {}
+
+		//? ========================================================
+		//? Marks an access, before the string is unlocked
+		//?
+		//? Stores once per tick, seq_cst like the state load of
+		//? c_str() that follows and the sweeper's state CAS then
+		//? _last load (see sweep): one of them sees the other.
+		//? ========================================================
+		inline void touch(void)
+		{
+			const uint32_t	now = ttlNow().load(std::memory_order_relaxed);
+
+			if (_last.load(std::memory_order_relaxed) != now)
+				_last.store(now, std::memory_order_seq_cst);
+			if (!_linked.load(std::memory_order_relaxed))
+				link();
+		}
+
+		//? ========================================================
+		//? Calls fn(TtlSlot&) for every string accessed so far
+		//? ========================================================
+		template<typename F>
+		static inline void for_each(F fn)
+		{
+			for (TtlSlot* p = head().load(std::memory_order_acquire); p; p = p->_next)
+				fn(*p);
+		}
+
+		//? relock when idle for the TTL, never waits, backs out
+		//? when touched meanwhile
+		inline void sweep(uint32_t now)
+		{
+			const uint32_t	last = _last.load(std::memory_order_relaxed);
+
+			if (uint32_t(now - last) >= _ttl)
+				_tryLock(_obj, _last, last);
+		}
+
+		inline void lock(void)
+		{
+			_lock(_obj);
+		}
+	};
+
+	//? ============================================================
+	//? Static string + its sweep slot (see OBF_STT)
+	//? ============================================================
+	template<typename T>
+	class TtlString
+	{
+	private:
+		T		_obj;
+		TtlSlot	_slot;
+
+		//? the string is ours (BUSY) when idle() runs: an access
+		//? since the sweep started either changed _last or waits
+		static bool tryLockObj(void* p, const std::atomic<uint32_t>& last, uint32_t seen)
+		{
+			return (static_cast<T*>(p)->try_lock_if([&last, seen]() { return (last.load(std::memory_order_seq_cst) == seen); }));
+		}
+
+		static void lockObj(void* p)
+		{
+			static_cast<T*>(p)->lock();
+		}
+	public:
+		SVXOR_FORCEINLINE constexpr TtlString(const char* s, uint64_t salt, uint32_t ms SVXOR_SITE_PARAM_DEF)
+			: _obj(s, salt SVXOR_SITE_ARG), _slot(&_obj, &TtlString::tryLockObj, &TtlString::lockObj, ms) {}
+
+		static inline constexpr size_t size(void)
+		{
+			return (T::size());
+		}
+
+		//? decodes when needed, stays decoded for the TTL (touch
+		//? first: a sweep in progress then backs out or is waited)
+		inline const char* c_str(void)
+		{
+			_slot.touch();
+			return (_obj.c_str());
+		}
+
+		//? pinned access: not relocked while the Reader lives
+		inline typename T::Reader read(void)
+		{
+			_slot.touch();
+			return (_obj.read());
+		}
+
+		inline size_t decode_to(char* dst, size_t cap)
+		{
+			return (_obj.decode_to(dst, cap));
+		}
+
+		//? never unlocks: no touch()
+		inline std::string to_string(void)
+		{
+			return (_obj.to_string());
+		}
+
+		//? relocked on scope exit, the sweeper has nothing to do
+		inline typename T::View view(void)
+		{
+			return (_obj.view());
+		}
+
+		//? partial reads never unlock: no touch()
+		inline size_t decode_range(size_t pos, size_t len, char* dst)
+		{
+			return (_obj.decode_range(pos, len, dst));
+		}
+
+		inline char at(size_t i)
+		{
+			return (_obj.at(i));
+		}
+
+		inline bool starts_with(const char* s)
+		{
+			return (_obj.starts_with(s));
+		}
+
+		inline void lock(void)
+		{
+			_obj.lock();
+		}
+	};
+
+	//? ============================================================
+	//? Sweeper thread
+	//? ============================================================
+	class TtlSweeper
+	{
+	private:
+		std::mutex			_mtx;
+		std::thread			_thread;
+		std::atomic<bool>	_run;
+
+		inline void loop(unsigned tickMs)
+		{
+			const std::chrono::steady_clock::time_point	t0 = std::chrono::steady_clock::now();
+
+			while (_run.load(std::memory_order_acquire))
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(tickMs));
+
+				const uint32_t	now = uint32_t(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - t0).count());
+
+				ttlNow().store(now, std::memory_order_relaxed);
+				TtlSlot::for_each([now](TtlSlot& s) { s.sweep(now); });
+			}
+		}
+	public:
+		inline TtlSweeper(void) : _run(false) {}
+
+		inline void start(unsigned tickMs)
+		{
+			std::lock_guard<std::mutex>	g(_mtx);
+
+			if (_thread.joinable())
+				return;
+			_run.store(true, std::memory_order_release);
+			_thread = std::thread([this, tickMs]() { loop(tickMs ? tickMs : 1); });
+		}
+
+		inline void stop(bool relock)
+		{
+			std::lock_guard<std::mutex>	g(_mtx);
+
+			if (_thread.joinable())
+			{
+				_run.store(false, std::memory_order_release);
+				_thread.join();
+			}
+			if (relock)
+				TtlSlot::for_each([](TtlSlot& s) { s.lock(); });
+		}
+
+		~TtlSweeper(void)
+		{
+			stop(true);
+		}
+	};
+
+	inline TtlSweeper& ttlSweeper(void)
+	{
+		static TtlSweeper	s;
+
+		return (s);
+	}
+
+	//? ============================================================
+	//? Starts the sweeper (no-op when running)
+	//?
+	//? tickMs bounds the relock latency: an idle string is locked
+	//? between ttl and ttl + tickMs after its last access.
+	//? ============================================================
+	inline void ttl_start(unsigned tickMs = 10)
+	{
+		ttlSweeper().start(tickMs);
+	}
+
+	//? ============================================================
+	//? Stops the sweeper, relocks every swept string by default
+	//? (waits for pinned readers). Also runs at exit.
+	//? ============================================================
+	inline void ttl_stop(bool relock = true)
+	{
+		ttlSweeper().stop(relock);
+	}
+}
+
+//! ============================================================
+//! MACROS
+//! ============================================================
+
+//? ============================================================
+//? OBF_STT(fname, "literal", heavy, ms)
+//? OBF_STTX(fname, "literal", heavy, flags, ms)
+//?
+//? Constant-initialized static like OBF_STC, obf_fname()
+//? returns the TtlString (c_str(), read(), decode_to(), lock()).
+//? ============================================================
+#  define OBF_STTX(fname, s, heavy, flags, ms) static constexpr uint64_t k_##fname = OBF_SALT(); SVXOR_SITE(site_##fname, k_##fname) static SVXOR_CONSTINIT svxor::TtlString<OBF_TYPE(s, heavy, flags)> s_##fname(s, k_##fname, ms SVXOR_SITE_REF(site_##fname)); SVXOR_REGISTER(s_##fname) static svxor::TtlString<OBF_TYPE(s, heavy, flags)>&	obf_##fname(void){return (s_##fname);}
+#  define OBF_STT(fname, s, heavy, ms) OBF_STTX(fname, s, heavy, svxor::KS_STORED, ms)
+#  define OBF_STTL(fname, s, ms) OBF_STT(fname, s, false, ms)
+#  define OBF_STTH(fname, s, ms) OBF_STT(fname, s, true, ms)
+
+# endif
+#endif
@@ -0,0 +1,505 @@
+/*
+ * MIT License
+ * Copyright © 2026 NyTekCFW
+ * See LICENSE file for details.
+*/
+
+//? ============================================================
+//? svxor_gen: offline catalog encryption (see svxor_catalog.hpp)
+//?
+//?   svxor_gen [--seed N | --seed-text S] [--ns name]
+//?             [--include path] -o out.hpp catalog.txt
+//?
+//? Catalog: one entry per line, '#' comments
+//?
+//?   id, name, "literal"[, mix | ctr]
+//?
+//? id:      decimal or 0x hex, unique (get(id))
+//? name:    C identifier, unique (obf_name())
+//? literal: C escapes (\n \t \" \\ \xHH \ooo...), UTF-8 as is
+//? mode:    keystream, mix (KS_REGEN, default) or ctr (KS_CTR)
+//?
+//? The output depends on the catalog and the seed only (no
+//? date, no path) and is left untouched when unchanged, so
+//? builds and caches see a stable header. Without a seed the
+//? catalog contents are hashed.
+//?
+//? Build: c++ -std=c++11 -O1 tools/svxor_gen.cpp -o svxor_gen
+//? ============================================================
+
+#include "../svxor.hpp"
+
+#include <cctype>
+#include <cerrno>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+	struct Item
+	{
+		uint32_t	id;
+		std::string	name;
+		std::string	text;
+		uint32_t	flags;
+		int			line;
+	};
+
+	struct Options
+	{
+		const char*	in;
+		const char*	out;
+		const char*	ns;
+		const char*	include;
+		uint64_t	seed;
+		bool		hasSeed;
+	};
+
+	bool fail(const char* file, int line, const char* why)
+	{
+		if (line)
+			std::fprintf(stderr, "%s:%d: error: %s\n", file, line, why);
+		else
+			std::fprintf(stderr, "%s: error: %s\n", file, why);
+		return (false);
+	}
+
+	//? svxor::fnv1a recurses per byte: loop for whole files
+	uint64_t hashBytes(const std::string& s)
+	{
+		uint64_t h = 1469598103934665603ULL;
+
+		for (size_t i = 0; i < s.size(); ++i)
+			h = (h ^ static_cast<uint8_t>(s[i])) * 1099511628211ULL;
+		return (h);
+	}
+
+	bool readFile(const char* path, std::string& out)
+	{
+		FILE*	f = std::fopen(path, "rb");
+		char	buf[4096];
+		size_t	n;
+
+		if (!f)
+			return (false);
+		while ((n = std::fread(buf, 1, sizeof(buf), f)) > 0)
+			out.append(buf, n);
+		std::fclose(f);
+		return (true);
+	}
+
+	//? ============================================================
+	//? Line scanner
+	//? ============================================================
+	struct Cursor
+	{
+		const char*	p;
+		const char*	end;
+
+		inline void skipSpace(void)
+		{
+			while (p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+				++p;
+		}
+
+		//? consumes c (after blanks)
+		inline bool eat(char c)
+		{
+			skipSpace();
+			if (p < end && *p == c)
+			{
+				++p;
+				return (true);
+			}
+			return (false);
+		}
+
+		inline std::string word(void)
+		{
+			const char* b;
+
+			skipSpace();
+			b = p;
+			while (p < end && (std::isalnum(static_cast<unsigned char>(*p)) || *p == '_'))
+				++p;
+			return (std::string(b, p));
+		}
+
+		inline bool done(void)
+		{
+			skipSpace();
+			return (p == end || *p == '#');
+		}
+	};
+
+	int hexDigit(char c)
+	{
+		if (c >= '0' && c <= '9')
+			return (c - '0');
+		if (c >= 'a' && c <= 'f')
+			return (c - 'a' + 10);
+		if (c >= 'A' && c <= 'F')
+			return (c - 'A' + 10);
+		return (-1);
+	}
+
+	//? ============================================================
+	//? "literal" with C escapes, no embedded NUL
+	//? ============================================================
+	const char* parseLiteral(Cursor& c, std::string& out)
+	{
+		if (!c.eat('"'))
+			return ("expected a quoted literal");
+		while (c.p < c.end && *c.p != '"')
+		{
+			int ch = static_cast<unsigned char>(*c.p++);
+
+			if (ch == '\\')
+			{
+				if (c.p == c.end)
+					break;
+				ch = *c.p++;
+				switch (ch)
+				{
+					case 'n': ch = '\n'; break;
+					case 't': ch = '\t'; break;
+					case 'r': ch = '\r'; break;
+					case 'a': ch = '\a'; break;
+					case 'b': ch = '\b'; break;
+					case 'f': ch = '\f'; break;
+					case 'v': ch = '\v'; break;
+					case '\\': case '"': case '\'': case '?': break;
+					case 'x':
+					{
+						int	v = 0;
+						int	n = 0;
+
+						for (; c.p < c.end && n < 2 && hexDigit(*c.p) >= 0; ++n)
+							v = v * 16 + hexDigit(*c.p++);
+						if (!n)
+							return ("\\x without hex digits");
+						ch = v;
+						break;
+					}
+					default:
+					{
+						if (ch < '0' || ch > '7')
+							return ("unknown escape");
+
+						int	v = ch - '0';
+
+						for (int n = 1; c.p < c.end && n < 3 && *c.p >= '0' && *c.p <= '7'; ++n)
+							v = v * 8 + (*c.p++ - '0');
+						if (v > 0xFF)
+							return ("octal escape out of range");
+						ch = v;
+						break;
+					}
+				}
+			}
+			if (!ch)
+				return ("embedded NUL");
+			out.push_back(char(ch));
+		}
+		if (c.p == c.end)
+			return ("unterminated literal");
+		++c.p;
+		return (nullptr);
+	}
+
+	const char* parseLine(Cursor& c, Item& it)
+	{
+		std::string	tok = c.word();
+		char*		endp = nullptr;
+		const char*	err;
+
+		errno = 0;
+		unsigned long long v = std::strtoull(tok.c_str(), &endp, 0);
+		if (tok.empty() || *endp || errno || v > 0xFFFFFFFFull)
+			return ("bad id (decimal or 0x hex, 32 bits)");
+		it.id = uint32_t(v);
+		if (!c.eat(','))
+			return ("expected ',' after the id");
+		it.name = c.word();
+		if (it.name.empty() || std::isdigit(static_cast<unsigned char>(it.name[0])))
+			return ("bad name (C identifier)");
+		if (!c.eat(','))
+			return ("expected ',' after the name");
+		if ((err = parseLiteral(c, it.text)))
+			return (err);
+		it.flags = svxor::KS_REGEN;
+		if (c.eat(','))
+		{
+			tok = c.word();
+			if (tok == "ctr")
+				it.flags |= svxor::KS_CTR;
+			else if (tok != "mix")
+				return ("bad mode (mix or ctr)");
+		}
+		if (!c.done())
+			return ("trailing characters");
+		return (nullptr);
+	}
+
+	bool parseCatalog(const char* path, const std::string& src, std::vector<Item>& items)
+	{
+		const char*	p = src.data();
+		const char*	end = p + src.size();
+		int			line = 0;
+
+		while (p < end)
+		{
+			const char*	eol = static_cast<const char*>(std::memchr(p, '\n', size_t(end - p)));
+			Cursor		c = { p, eol ? eol : end };
+			Item		it;
+			const char*	err;
+
+			++line;
+			p = eol ? eol + 1 : end;
+			if (c.done())
+				continue;
+			it.line = line;
+			if ((err = parseLine(c, it)))
+				return (fail(path, line, err));
+			for (size_t i = 0; i < items.size(); ++i)
+			{
+				if (items[i].id == it.id)
+					return (fail(path, line, "duplicate id"));
+				if (items[i].name == it.name)
+					return (fail(path, line, "duplicate name"));
+			}
+			items.push_back(it);
+		}
+		if (items.size() > 0xFFFE)
+			return (fail(path, 0, "too many entries (65534 max)"));
+		return (true);
+	}
+
+	//? ============================================================
+	//? Per entry key: seed, id and name, so reordering the catalog
+	//? doesn't change the ciphertext of an entry
+	//? ============================================================
+	uint64_t entryKey(uint64_t seed, const Item& it)
+	{
+		return (svxor::mix64(seed ^ hashBytes(it.name) ^ (uint64_t(it.id) * 0x9E3779B97F4A7C15ULL)));
+	}
+
+	//? ObfString ciphertext of it.text (streamKey, Cipher::at)
+	void encrypt(const Item& it, uint64_t k, std::vector<uint8_t>& blob)
+	{
+		const uint64_t	sk = (it.flags & svxor::KS_CTR) ? svxor::streamKey<svxor::KS_REGEN | svxor::KS_CTR>(k) : svxor::streamKey<svxor::KS_REGEN>(k);
+
+		for (size_t i = 0; i < it.text.size(); ++i)
+		{
+			const char ks = (it.flags & svxor::KS_CTR) ? svxor::Cipher<true>::at(sk, i) : svxor::Cipher<false>::at(sk, i);
+
+			blob.push_back(uint8_t(it.text[i] ^ ks));
+		}
+		blob.push_back(0);
+	}
+
+	void appendf(std::string& out, const char* fmt, ...)
+	{
+		char	buf[512];
+		va_list	ap;
+		int		n;
+
+		va_start(ap, fmt);
+		n = std::vsnprintf(buf, sizeof(buf), fmt, ap);
+		va_end(ap);
+		out.append(buf, (n < 0) ? 0 : ((size_t(n) < sizeof(buf)) ? size_t(n) : sizeof(buf) - 1));
+	}
+
+	const char* baseName(const char* path)
+	{
+		const char* b = path;
+
+		for (const char* p = path; *p; ++p)
+		{
+			if (*p == '/' || *p == '\\')
+				b = p + 1;
+		}
+		return (b);
+	}
+
+	//? ============================================================
+	//? Header
+	//? ============================================================
+	std::string emit(const Options& o, const std::vector<Item>& items)
+	{
+		std::vector<uint8_t>	blob;
+		std::vector<uint32_t>	off;
+		std::vector<uint64_t>	key;
+		std::vector<uint16_t>	index;
+		std::string				h;
+		uint32_t				base = 0;
+		uint32_t				span = 0;
+		size_t					chars = 0;	//? terminators excluded
+		const size_t			count = items.size();
+
+		for (size_t e = 0; e < count; ++e)
+		{
+			off.push_back(uint32_t(blob.size()));
+			key.push_back(entryKey(o.seed, items[e]));
+			encrypt(items[e], key.back(), blob);
+			chars += items[e].text.size();
+		}
+
+		//? dense when the id range is at most ~2 slots per entry
+		if (count)
+		{
+			uint32_t hi = items[0].id;
+
+			base = items[0].id;
+			for (size_t e = 1; e < count; ++e)
+			{
+				base = (items[e].id < base) ? items[e].id : base;
+				hi = (items[e].id > hi) ? items[e].id : hi;
+			}
+			if (uint64_t(hi) - base + 1 <= 2 * uint64_t(count) + 64)
+				span = hi - base + 1;
+		}
+		if (span)
+		{
+			index.assign(span, 0);
+			for (size_t e = 0; e < count; ++e)
+				index[items[e].id - base] = uint16_t(e + 1);
+		}
+		else
+		{
+			for (size_t e = 0; e < count; ++e)
+				index.push_back(uint16_t(e));
+			for (size_t i = 1; i < count; ++i)
+			{
+				for (size_t j = i; j > 0 && items[index[j - 1]].id > items[index[j]].id; --j)
+				{
+					const uint16_t t = index[j];
+
+					index[j] = index[j - 1];
+					index[j - 1] = t;
+				}
+			}
+		}
+
+		appendf(h, "// Generated by svxor_gen from %s, do not edit.\n", baseName(o.in));
+		appendf(h, "// seed 0x%016llX, %zu entries, %zu bytes, %s index\n\n", (unsigned long long)o.seed, count, blob.size(), span ? "dense" : "sorted");
+		h += "#pragma once\n\n";
+		appendf(h, "#include \"%s\"\n\n", o.include);
+		appendf(h, "namespace %s\n{\n", o.ns);
+		h += "\tinline svxor::Catalog& catalog(void)\n\t{\n";
+		appendf(h, "\t\tstatic unsigned char blob[%zu] =\n\t\t{", blob.empty() ? size_t(1) : blob.size());
+		for (size_t i = 0; i < blob.size(); ++i)
+			appendf(h, "%s0x%02X,", (i % 16) ? " " : "\n\t\t\t", blob[i]);
+		if (blob.empty())
+			h += "\n\t\t\t0x00,";
+		h += "\n\t\t};\n";
+		appendf(h, "\t\tstatic constexpr svxor::CatalogEntry entry[%zu] =\n\t\t{\n", count ? count : size_t(1));
+		for (size_t e = 0; e < count; ++e)
+			appendf(h, "\t\t\t{ 0x%08X, %u, %u, %u, 0x%016llXULL },\n", items[e].id, off[e], unsigned(items[e].text.size()), items[e].flags, (unsigned long long)key[e]);
+		if (!count)
+			h += "\t\t\t{ 0, 0, 0, 0, 0 },\n";
+		h += "\t\t};\n";
+		appendf(h, "\t\tstatic constexpr uint16_t index[%zu] =\n\t\t{", index.empty() ? size_t(1) : index.size());
+		for (size_t i = 0; i < index.size(); ++i)
+			appendf(h, "%s%u,", (i % 16) ? " " : "\n\t\t\t", index[i]);
+		if (index.empty())
+			h += "\n\t\t\t0,";
+		h += "\n\t\t};\n";
+		appendf(h, "\t\tstatic std::atomic<uint8_t> state[%zu];\n", count ? count : size_t(1));
+		appendf(h, "\t\tstatic SVXOR_CONSTINIT svxor::Catalog cat(blob, entry, state, index, %zu, 0x%08X, %u);\n", count, base, span);
+		h += "#ifdef SVXOR_HAS_REGISTRY\n";
+		appendf(h, "\t\tstatic SVXOR_CONSTINIT const svxor::RegEntry reg SVXOR_REG_SECTION_INLINE = svxor::regEntry(cat, %zu);\n\n", chars);
+		h += "\t\t(void)reg;\n#endif\n\n";
+		h += "\t\treturn (cat);\n\t}\n\n";
+		h += "\tinline const char* get(uint32_t id)\n\t{\n\t\treturn (catalog().get(id));\n\t}\n\n";
+		h += "\tinline void lock(void)\n\t{\n\t\tcatalog().lock();\n\t}\n";
+		if (count)
+			h += "\n";
+		for (size_t e = 0; e < count; ++e)
+			appendf(h, "\tconstexpr uint32_t id_%s = 0x%08X;\n", items[e].name.c_str(), items[e].id);
+		if (count)
+			h += "\n";
+		for (size_t e = 0; e < count; ++e)
+			appendf(h, "\tinline const char* obf_%s(void) { return (catalog().by_index(%zu)); }\n", items[e].name.c_str(), e);
+		h += "}\n";
+		return (h);
+	}
+
+	bool parseArgs(int argc, char** argv, Options& o)
+	{
+		o.in = nullptr;
+		o.out = nullptr;
+		o.ns = "catalog";
+		o.include = "svxor_catalog.hpp";
+		o.seed = 0;
+		o.hasSeed = false;
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string	a = argv[i];
+			const bool			hasVal = (i + 1 < argc);
+
+			if (a == "-o" && hasVal)
+				o.out = argv[++i];
+			else if (a == "--ns" && hasVal)
+				o.ns = argv[++i];
+			else if (a == "--include" && hasVal)
+				o.include = argv[++i];
+			else if (a == "--seed" && hasVal)
+			{
+				char* endp = nullptr;
+
+				errno = 0;
+				o.seed = std::strtoull(argv[++i], &endp, 0);
+				if (*endp || errno)
+					return (fail(argv[0], 0, "bad --seed (64-bit number)"));
+				o.hasSeed = true;
+			}
+			else if (a == "--seed-text" && hasVal)
+			{
+				o.seed = hashBytes(argv[++i]);
+				o.hasSeed = true;
+			}
+			else if (a[0] != '-' && !o.in)
+				o.in = argv[i];
+			else
+				return (false);
+		}
+		return (o.in && o.out);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Options				o;
+	std::string			src;
+	std::string			old;
+	std::string			h;
+	std::vector<Item>	items;
+	FILE*				f;
+
+	if (!parseArgs(argc, argv, o))
+	{
+		std::fprintf(stderr, "usage: %s [--seed N | --seed-text S] [--ns name] [--include path] -o out.hpp catalog.txt\n", argv[0]);
+		return (2);
+	}
+	if (!readFile(o.in, src))
+		return (fail(o.in, 0, std::strerror(errno)), 1);
+	if (!parseCatalog(o.in, src, items))
+		return (1);
+	if (!o.hasSeed)
+		o.seed = svxor::mix64(hashBytes(src));
+	h = emit(o, items);
+
+	//? unchanged output: keep the file (and its mtime)
+	if (readFile(o.out, old) && old == h)
+		return (0);
+	if (!(f = std::fopen(o.out, "wb")))
+		return (fail(o.out, 0, std::strerror(errno)), 1);
+	if (std::fwrite(h.data(), 1, h.size(), f) != h.size() || std::fclose(f) != 0)
+		return (fail(o.out, 0, "write failed"), 1);
+	return (0);
+}